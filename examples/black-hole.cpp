@@ -121,7 +121,8 @@ public:
   enum {
     PROPAGATION_REIFIED,  ///< Reified propagation
     PROPAGATION_DFA,      ///< Extensional propagation using automatons
-    PROPAGATION_TUPLE_SET ///< Extensional propagation using tables
+    PROPAGATION_TUPLE_SET,///< Extensional propagation using tables
+    PROPAGATION_MDD       ///< Extensional propagation using MDDs
   };
   /// Actual model
   BlackHole(const SizeOptions& opt)
@@ -168,7 +169,7 @@ public:
       for (int i = 51; i--; )
         extensional(*this, IntVarArgs() << x[i] << x[i+1], table);
 
-    } else { // opt.propagation() == PROPAGATION_TUPLE_SET)
+    } else {
       // Build table for allowed tuples
       TupleSet ts(2);
       for (int r = 13; r--; )
@@ -178,8 +179,14 @@ public:
               ts.add(r+13*s1, (r+i+52+13*s2)%52);
       ts.finalize();
 
-      for (int i = 51; i--; )
-        extensional(*this, IntVarArgs() << x[i] << x[i+1], ts);
+      if (opt.propagation() == PROPAGATION_MDD) {
+        MDD m(ts);
+        for (int i = 51; i--; )
+          extensional(*this, IntVarArgs() << x[i] << x[i+1], m);
+      } else { // opt.propagation() == PROPAGATION_TUPLE_SET)
+        for (int i = 51; i--; )
+          extensional(*this, IntVarArgs() << x[i] << x[i+1], ts);
+      }
     }
 
     // A card must be played before the one under it.
@@ -305,6 +312,8 @@ main(int argc, char* argv[]) {
                   "dfa", "use DFA-based extensional propagation");
   opt.propagation(BlackHole::PROPAGATION_TUPLE_SET,
                   "tuple-set", "use TupleSet-based extensional propagation");
+  opt.propagation(BlackHole::PROPAGATION_MDD,
+                  "mdd", "use MDD-based extensional propagation");
   opt.ipl(IPL_DOM);
   opt.parse(argc,argv);
   // Generates the new board
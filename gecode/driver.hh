@@ -382,8 +382,11 @@ namespace Gecode {
     Driver::StringOption      _search;        ///< Search options
     Driver::UnsignedIntOption _solutions;     ///< How many solutions
     Driver::DoubleOption      _threads;       ///< How many threads to use
+    Driver::BoolOption        _deterministic; ///< Whether parallel search is deterministic
+    Driver::UnsignedIntOption _d_split;       ///< Split depth for deterministic search
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
+    Driver::BoolOption        _batch;         ///< Whether to use strict batch recomputation
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
     Driver::UnsignedIntOption _node;          ///< Cutoff for number of nodes
     Driver::UnsignedIntOption _fail;          ///< Cutoff for number of failures
@@ -396,6 +399,7 @@ namespace Gecode {
     Driver::BoolOption        _nogoods;       ///< Whether to use no-goods
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
     Driver::DoubleOption      _relax;         ///< Probability to relax variable
+    Driver::BoolOption        _instrument;    ///< Whether search is instrumented
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
     //@}
 
@@ -405,6 +409,7 @@ namespace Gecode {
     Driver::UnsignedIntOption _samples;       ///< How many samples
     Driver::UnsignedIntOption _iterations;    ///< How many iterations per sample
     Driver::BoolOption        _print_last;    ///< Print only last solution found
+    Driver::BoolOption        _json;          ///< Print statistics in JSON format
     Driver::StringValueOption _out_file;      ///< Where to print solutions
     Driver::StringValueOption _log_file;      ///< Where to print statistics
     Driver::TraceOption       _trace;         ///< Trace flags for tracing
@@ -491,6 +496,16 @@ namespace Gecode {
     /// Return number of parallel threads
     double threads(void) const;
 
+    /// Set whether parallel search is deterministic
+    void deterministic(bool b);
+    /// Return whether parallel search is deterministic
+    bool deterministic(void) const;
+
+    /// Set split depth for deterministic parallel search
+    void d_split(unsigned int d);
+    /// Return split depth for deterministic parallel search
+    unsigned int d_split(void) const;
+
     /// Set default copy recomputation distance
     void c_d(unsigned int d);
     /// Return copy recomputation distance
@@ -501,6 +516,11 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
 
+    /// Set default strict batch recomputation behavior
+    void batch(bool b);
+    /// Return whether strict batch recomputation is used
+    bool batch(void) const;
+
     /// Set default discrepancy limit for LDS
     void d_l(unsigned int d);
     /// Return discrepancy limit for LDS
@@ -561,6 +581,11 @@ namespace Gecode {
     /// Return default relax probability
     double relax(void) const;
 
+    /// Set default instrumentation behavior
+    void instrument(bool b);
+    /// Return whether search is instrumented
+    bool instrument(void) const;
+
     /// Set default interrupt behavior
     void interrupt(bool b);
     /// Return interrupt behavior
@@ -589,6 +614,11 @@ namespace Gecode {
     /// Return whether to print only last solution found
     bool print_last(void) const;
 
+    /// Set whether to print statistics in JSON format
+    void json(bool j);
+    /// Return whether to print statistics in JSON format
+    bool json(void) const;
+
     /// Set default output file name for solutions
     void out_file(const char* f);
     /// Get file name for solutions
@@ -580,8 +580,14 @@ namespace Gecode {
       _solutions("solutions","number of solutions (0 = all)",1),
       _threads("threads","number of threads (0 = #processing units)",
                Search::Config::threads),
+      _deterministic("deterministic",
+                     "whether parallel search is deterministic",false),
+      _d_split("d-split","split depth for deterministic parallel search",
+               Search::Config::d_split),
       _c_d("c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("a-d","recomputation adaptation distance",Search::Config::a_d),
+      _batch("batch","whether to propagate only once per recomputation",
+             false),
       _d_l("d-l","discrepancy limit for LDS",Search::Config::d_l),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
@@ -597,6 +603,8 @@ namespace Gecode {
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
       _relax("relax","probability for relaxing variable", 0.0),
+      _instrument("instrument","whether to measure time spent by search",
+                  false),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
 
@@ -606,6 +614,8 @@ namespace Gecode {
       _print_last("print-last",
                   "whether to only print the last solution (solution mode)",
                   false),
+      _json("json","whether to print statistics in JSON format "
+            "(solution and stat mode)",false),
       _out_file("file-sol", "where to print solutions "
                 "(supports stdout, stdlog, stderr)","stdout"),
       _log_file("file-stat", "where to print statistics "
@@ -636,13 +646,15 @@ namespace Gecode {
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
     add(_branching); add(_decay); add(_seed); add(_step);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
-    add(_d_l);
+    add(_batch);
+    add(_d_l); add(_deterministic); add(_d_split);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
     add(_nogoods); add(_nogoods_limit);
-    add(_relax);
+    add(_relax); add(_instrument);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
+    add(_json);
     add(_out_file); add(_log_file); add(_trace);
 #ifdef GECODE_HAS_CPPROFILER
     add(_profiler_id);
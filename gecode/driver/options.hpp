@@ -297,6 +297,24 @@ namespace Gecode {
     return _threads.value();
   }
 
+  inline void
+  Options::deterministic(bool b) {
+    _deterministic.value(b);
+  }
+  inline bool
+  Options::deterministic(void) const {
+    return _deterministic.value();
+  }
+
+  inline void
+  Options::d_split(unsigned int d) {
+    _d_split.value(d);
+  }
+  inline unsigned int
+  Options::d_split(void) const {
+    return _d_split.value();
+  }
+
   inline void
   Options::c_d(unsigned int d) {
     _c_d.value(d);
@@ -315,6 +333,15 @@ namespace Gecode {
     return _a_d.value();
   }
 
+  inline void
+  Options::batch(bool b) {
+    _batch.value(b);
+  }
+  inline bool
+  Options::batch(void) const {
+    return _batch.value();
+  }
+
   inline void
   Options::d_l(unsigned int d) {
     _d_l.value(d);
@@ -423,6 +450,15 @@ namespace Gecode {
     return _relax.value();
   }
 
+  inline void
+  Options::instrument(bool b) {
+    _instrument.value(b);
+  }
+  inline bool
+  Options::instrument(void) const {
+    return _instrument.value();
+  }
+
 
 
   inline void
@@ -475,6 +511,15 @@ namespace Gecode {
     return _print_last.value();
   }
 
+  inline void
+  Options::json(bool j) {
+    _json.value(j);
+  }
+  inline bool
+  Options::json(void) const {
+    return _json.value();
+  }
+
   inline void
   Options::out_file(const char *f) {
     _out_file.value(f);
@@ -70,6 +70,66 @@ namespace Gecode { namespace Driver {
   }
 
 
+  /// Print the first \a n entries of histogram \a h up to the last non-zero one
+  static void
+  json(std::ostream& os, const Search::Statistics& stat,
+       unsigned long int (Search::Statistics::*h)(unsigned int) const,
+       unsigned int n) {
+    while ((n > 0) && ((stat.*h)(n-1) == 0))
+      n--;
+    os << "[";
+    for (unsigned int i=0; i<n; i++)
+      os << ((i > 0) ? "," : "") << (stat.*h)(i);
+    os << "]";
+  }
+
+  void
+  json(std::ostream& os, const Search::Statistics& stat, double t,
+       unsigned int s, unsigned int n_p, unsigned int n_b, bool stopped) {
+    std::ios_base::fmtflags f = os.flags();
+    std::streamsize p = os.precision();
+    os << std::fixed << std::setprecision(3)
+       << "{" << std::endl
+       << "  \"stopped\": " << (stopped ? "true" : "false") << "," << std::endl
+       << "  \"propagators\": " << n_p << "," << std::endl
+       << "  \"branchers\": " << n_b << "," << std::endl
+       << "  \"runtime\": " << t << "," << std::endl
+       << "  \"solutions\": " << s << "," << std::endl
+       << "  \"propagations\": " << stat.propagate << "," << std::endl
+       << "  \"nodes\": " << stat.node << "," << std::endl
+       << "  \"failures\": " << stat.fail << "," << std::endl
+       << "  \"restarts\": " << stat.restart << "," << std::endl
+       << "  \"nogoods\": " << stat.nogood << "," << std::endl
+       << "  \"depth\": " << stat.depth << "," << std::endl
+       << "  \"steals\": " << stat.steal << "," << std::endl
+       << "  \"steals_failed\": " << stat.steal_fail << "," << std::endl
+       << "  \"steals_remote\": " << stat.steal_remote << "," << std::endl
+       << "  \"clones\": " << stat.clone << "," << std::endl
+       << "  \"recomputations\": " << stat.recompute << "," << std::endl
+       << "  \"memory\": " << stat.memory << "," << std::endl
+#ifdef GECODE_PEAKHEAP
+       << "  \"peak_memory\": " << heap.peak() << "," << std::endl
+#endif
+       << "  \"time\": {" << std::endl
+       << "    \"propagate\": " << stat.t_propagate << "," << std::endl
+       << "    \"clone\": " << stat.t_clone << "," << std::endl
+       << "    \"recompute\": " << stat.t_recompute << "," << std::endl
+       << "    \"steal\": " << stat.t_steal << "," << std::endl
+       << "    \"idle\": " << stat.t_idle << std::endl
+       << "  }," << std::endl
+       << "  \"fail_depth\": ";
+    json(os, stat, &Search::Statistics::fail_depth,
+         Search::Config::fail_depth);
+    os << "," << std::endl
+       << "  \"steal_worker\": ";
+    json(os, stat, &Search::Statistics::steal_worker,
+         Search::Config::steal_worker);
+    os << std::endl
+       << "}" << std::endl;
+    os.flags(f);
+    os.precision(p);
+  }
+
   double
   am(double t[], unsigned int n) {
     if (n < 1)
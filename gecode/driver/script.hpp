@@ -135,6 +135,18 @@ namespace Gecode { namespace Driver {
   GECODE_DRIVER_EXPORT void
   stop(Support::Timer& t, std::ostream& os);
 
+  /**
+   * \brief Print statistics \a stat in JSON format
+   *
+   * Besides the search statistics, the runtime \a t (in milliseconds),
+   * the number of solutions \a s, the number of propagators \a n_p and
+   * branchers \a n_b, and whether search has been \a stopped are
+   * printed.
+   */
+  GECODE_DRIVER_EXPORT void
+  json(std::ostream& os, const Search::Statistics& stat, double t,
+       unsigned int s, unsigned int n_p, unsigned int n_b, bool stopped);
+
   /**
    * \brief Compute arithmetic mean of \a n elements in \a t
    */
@@ -370,8 +382,12 @@ namespace Gecode { namespace Driver {
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
           so.threads = o.threads();
+          so.deterministic = o.deterministic();
+          so.d_split = o.d_split();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.batch   = o.batch();
+          so.instrument = o.instrument();
           so.d_l     = o.d_l();
           so.assets  = o.assets();
           so.slice   = o.slice();
@@ -412,44 +428,50 @@ namespace Gecode { namespace Driver {
               CombinedStop::installCtrlHandler(false);
             Search::Statistics stat = e.statistics();
             s_out << endl;
-            if (e.stopped()) {
-              l_out << "Search engine stopped..." << endl
-                    << "\treason: ";
-              int r = static_cast<CombinedStop*>(so.stop)->reason(stat,so);
-              if (r & CombinedStop::SR_INT)
-                l_out << "user interrupt " << endl;
-              else {
-                if (r & CombinedStop::SR_NODE)
-                  l_out << "node ";
-                if (r & CombinedStop::SR_FAIL)
-                  l_out << "fail ";
-                if (r & CombinedStop::SR_TIME)
-                  l_out << "time ";
-                l_out << "limit reached" << endl << endl;
+            if (o.json()) {
+              json(l_out, stat, t.stop(),
+                   ::abs(static_cast<int>(o.solutions()) - i),
+                   n_p, n_b, e.stopped());
+            } else {
+              if (e.stopped()) {
+                l_out << "Search engine stopped..." << endl
+                      << "\treason: ";
+                int r = static_cast<CombinedStop*>(so.stop)->reason(stat,so);
+                if (r & CombinedStop::SR_INT)
+                  l_out << "user interrupt " << endl;
+                else {
+                  if (r & CombinedStop::SR_NODE)
+                    l_out << "node ";
+                  if (r & CombinedStop::SR_FAIL)
+                    l_out << "fail ";
+                  if (r & CombinedStop::SR_TIME)
+                    l_out << "time ";
+                  l_out << "limit reached" << endl << endl;
+                }
               }
-            }
-            l_out << "Initial" << endl
-                  << "\tpropagators: " << n_p << endl
-                  << "\tbranchers:   " << n_b << endl
-                  << endl
-                  << "Summary" << endl
-                  << "\truntime:      ";
-            stop(t, l_out);
-            l_out << endl
-                  << "\tsolutions:    "
-                  << ::abs(static_cast<int>(o.solutions()) - i) << endl
-                  << "\tpropagations: " << stat.propagate << endl
-                  << "\tnodes:        " << stat.node << endl
-                  << "\tfailures:     " << stat.fail << endl
-                  << "\trestarts:     " << stat.restart << endl
-                  << "\tno-goods:     " << stat.nogood << endl
-                  << "\tpeak depth:   " << stat.depth << endl
+              l_out << "Initial" << endl
+                    << "\tpropagators: " << n_p << endl
+                    << "\tbranchers:   " << n_b << endl
+                    << endl
+                    << "Summary" << endl
+                    << "\truntime:      ";
+              stop(t, l_out);
+              l_out << endl
+                    << "\tsolutions:    "
+                    << ::abs(static_cast<int>(o.solutions()) - i) << endl
+                    << "\tpropagations: " << stat.propagate << endl
+                    << "\tnodes:        " << stat.node << endl
+                    << "\tfailures:     " << stat.fail << endl
+                    << "\trestarts:     " << stat.restart << endl
+                    << "\tno-goods:     " << stat.nogood << endl
+                    << "\tpeak depth:   " << stat.depth << endl
 #ifdef GECODE_PEAKHEAP
-                  << "\tpeak memory:  "
-                  << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
-                  << endl
+                    << "\tpeak memory:  "
+                    << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
+                    << endl
 #endif
-                  << endl;
+                    << endl;
+            }
           }
           delete so.stop;
           delete so.tracer;
@@ -468,10 +490,14 @@ namespace Gecode { namespace Driver {
 
           so.clone   = false;
           so.threads = o.threads();
+          so.deterministic = o.deterministic();
+          so.d_split = o.d_split();
           so.assets  = o.assets();
           so.slice   = o.slice();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.batch   = o.batch();
+          so.instrument = o.instrument();
           so.d_l     = o.d_l();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                             o.interrupt());
@@ -490,26 +516,32 @@ namespace Gecode { namespace Driver {
             if (o.interrupt())
               CombinedStop::installCtrlHandler(false);
             Search::Statistics stat = e.statistics();
-            l_out << endl
-                  << "\tpropagators:  " << n_p << endl
-                  << "\tbranchers:    " << n_b << endl
-                  << "\truntime:      ";
-            stop(t, l_out);
-            l_out << endl
-                  << "\tsolutions:    "
-                  << ::abs(static_cast<int>(o.solutions()) - i) << endl
-                  << "\tpropagations: " << stat.propagate << endl
-                  << "\tnodes:        " << stat.node << endl
-                  << "\tfailures:     " << stat.fail << endl
-                  << "\trestarts:     " << stat.restart << endl
-                  << "\tno-goods:     " << stat.nogood << endl
-                  << "\tpeak depth:   " << stat.depth << endl
+            if (o.json()) {
+              json(l_out, stat, t.stop(),
+                   ::abs(static_cast<int>(o.solutions()) - i),
+                   n_p, n_b, e.stopped());
+            } else {
+              l_out << endl
+                    << "\tpropagators:  " << n_p << endl
+                    << "\tbranchers:    " << n_b << endl
+                    << "\truntime:      ";
+              stop(t, l_out);
+              l_out << endl
+                    << "\tsolutions:    "
+                    << ::abs(static_cast<int>(o.solutions()) - i) << endl
+                    << "\tpropagations: " << stat.propagate << endl
+                    << "\tnodes:        " << stat.node << endl
+                    << "\tfailures:     " << stat.fail << endl
+                    << "\trestarts:     " << stat.restart << endl
+                    << "\tno-goods:     " << stat.nogood << endl
+                    << "\tpeak depth:   " << stat.depth << endl
 #ifdef GECODE_PEAKHEAP
-                  << "\tpeak memory:  "
-                  << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
-                  << endl
+                    << "\tpeak memory:  "
+                    << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
+                    << endl
 #endif
-                  << endl;
+                    << endl;
+            }
           }
           delete so.stop;
         }
@@ -528,10 +560,13 @@ namespace Gecode { namespace Driver {
               Search::Options so;
               so.clone   = false;
               so.threads = o.threads();
+              so.deterministic = o.deterministic();
+              so.d_split = o.d_split();
               so.assets  = o.assets();
               so.slice   = o.slice();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
+              so.batch   = o.batch();
               so.d_l     = o.d_l();
               so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
                                                 false);
@@ -51,15 +51,6 @@
 
 namespace std {
 
-  /// Hashing for tuple sets
-  template<> struct hash<Gecode::TupleSet> {
-    /// Return hash key for \a x
-    forceinline size_t
-    operator()(const Gecode::TupleSet& x) const {
-      return x.hash();
-    }
-  };
-
   /// Hashing for tuple sets
   template<> struct hash<Gecode::SharedArray<int> > {
     /// Return hash key for \a x
@@ -72,14 +63,6 @@ namespace std {
     }
   };
 
-  /// Hashing for DFAs
-  template<> struct hash<Gecode::DFA> {
-    /// Return hash key for \a d
-    forceinline size_t operator()(const Gecode::DFA& d) const {
-      return d.hash();
-    }
-  };
-
 }
 
 namespace Gecode { namespace FlatZinc {
@@ -752,20 +735,10 @@ namespace Gecode { namespace FlatZinc {
 
   class FlatZincSpaceInitData {
   public:
-    /// Hash table of tuple sets
-    typedef std::unordered_set<TupleSet> TupleSetSet;
-    /// Hash table of tuple sets
-    TupleSetSet tupleSetSet;
-
     /// Hash table of shared integer arrays
     typedef std::unordered_set<SharedArray<int> > IntSharedArraySet;
     /// Hash table of shared integer arrays
     IntSharedArraySet intSharedArraySet;
-
-    /// Hash table of DFAs
-    typedef std::unordered_set<DFA> DFASet;
-    /// Hash table of DFAs
-    DFASet dfaSet;
     
     /// Initialize
     FlatZincSpaceInitData(void) {}
@@ -1621,7 +1594,11 @@ namespace Gecode { namespace FlatZinc {
   }
 
   FlatZincSpace::~FlatZincSpace(void) {
-    delete _initData;
+    if (_initData != NULL) {
+      delete _initData;
+      // Drop the tuple sets and DFAs interned for this model
+      ExtensionalCache::evict();
+    }
     delete _solveAnnotations;
   }
 
@@ -2139,17 +2116,12 @@ namespace Gecode { namespace FlatZinc {
       }
       ts.add(t);
     }
-    ts.finalize();
 
-    if (_initData) {
-      FlatZincSpaceInitData::TupleSetSet::iterator it = _initData->tupleSetSet.find(ts);
-      if (it != _initData->tupleSetSet.end()) {
-        return *it;
-      }
-      _initData->tupleSetSet.insert(ts);
-    }
-    
-    
+    // Share equal tuple sets (without computing their supports)
+    if (_initData)
+      return ExtensionalCache::intern(ts);
+
+    ts.finalize();
     return ts;
   }
   IntSharedArray
@@ -2397,13 +2369,8 @@ namespace Gecode { namespace FlatZinc {
 
   DFA
   FlatZincSpace::getSharedDFA(DFA& a) {
-    if (_initData) {
-      FlatZincSpaceInitData::DFASet::iterator it = _initData->dfaSet.find(a);
-      if (it != _initData->dfaSet.end()) {
-        return *it;
-      }
-      _initData->dfaSet.insert(a);
-    }
+    if (_initData)
+      return ExtensionalCache::intern(a);
     return a;
   }
 
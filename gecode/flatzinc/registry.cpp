@@ -1154,8 +1154,7 @@ namespace Gecode { namespace FlatZinc {
         }
         ts.add(t);
       }
-      ts.finalize();
-      extensional(s,x,ts,s.ann2ipl(ann));
+      extensional(s,x,ExtensionalCache::intern(ts),s.ann2ipl(ann));
     }
 
     void p_cumulative_opt(FlatZincSpace& s, const ConExpr& ce,
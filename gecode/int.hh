@@ -2005,7 +2005,7 @@ namespace Gecode {
    *
    * Extensional constraints support different ways of how the
    * extensionally defined relation between the variables is defined.
-   * Examples include specification by a %DFA or a table.
+   * Examples include specification by a %DFA, a table, or an %MDD.
    *
    * A %DFA can be defined by a regular expression, for regular expressions
    * see the module MiniModel.
@@ -2021,6 +2021,7 @@ namespace Gecode {
    * \ingroup TaskModelIntExt
    */
   class DFA : public SharedHandle {
+    friend class ExtensionalCache;
   private:
     /// Implementation of DFA
     class DFAI;
@@ -2135,9 +2136,20 @@ namespace Gecode {
    * constraint. After a TupleSet is finalized, no more tuples may be
    * added to it.
    *
+   * Besides plain tuples, a tuple set can store compressed tuples
+   * (also known as short or smart tuples): each entry of a compressed
+   * tuple is either a range of values or the wildcard TupleSet::star.
+   * A wildcard matches any value. Compressed tuples are propagated
+   * without being expanded, following:
+   *   H. Verhaeghe, C. Lecoutre, P. Schaus, Extending Compact-Table
+   *   to negative and short tables, AAAI 2017.
+   *   H. Verhaeghe, C. Lecoutre, Y. Deville, P. Schaus, Extending
+   *   Compact-Table to basic smart tables, CP 2017.
+   *
    * \ingroup TaskModelIntExt
    */
   class TupleSet : public SharedHandle {
+    friend class ExtensionalCache;
   public:
     /** \brief Type of a tuple
      *
@@ -2153,12 +2165,32 @@ namespace Gecode {
       int min;
       /// Maximum value
       int max;
+      /**
+       * \brief Whether the values are only matched by wildcards
+       *
+       * All values of such a range share the supports \a s (the tuples
+       * with a wildcard at this position) and have empty strict
+       * supports \a ss.
+       */
+      bool wild;
       /// Begin of supports
       BitSetData* s;
+      /**
+       * \brief Begin of strict supports
+       *
+       * Strict supports only contain tuples that match exactly one
+       * value at this position (that is, not tuples with wildcards).
+       * They coincide with \a s if there are no wildcards and are
+       * \a nullptr if some compressed tuple has a range of values at
+       * this position.
+       */
+      BitSetData* ss;
       /// Return the width
       unsigned int width(void) const;
       /// Return the supports for value \a n
       const BitSetData* supports(unsigned int n_words, int n) const;
+      /// Return the strict supports for value \a n
+      const BitSetData* strict(unsigned int n_words, int n) const;
     };
   protected:
     /// Data about values in the table
@@ -2186,8 +2218,17 @@ namespace Gecode {
       unsigned int n_words;
       /// Number of Tuples
       int n_tuples;
-      /// Number of free tuple entries of arity
+      /**
+       * \brief Number of free tuple entries of arity
+       *
+       * Is -2 if the tuples are in canonical form and -1 if the data
+       * structure is finalized.
+       */
       int n_free;
+      /// Number of compressed tuples
+      int n_compressed;
+      /// Number of free compressed tuple entries
+      int n_cfree;
       /// Smallest value
       int min;
       /// Largest value
@@ -2196,6 +2237,8 @@ namespace Gecode {
       std::size_t key;
       /// Tuple data
       int* td;
+      /// Compressed tuple data (lower bounds followed by upper bounds)
+      int* cd;
       /// Value data
       ValueData* vd;
       /// Pointer to all ranges
@@ -2207,6 +2250,10 @@ namespace Gecode {
       Tuple add(void);
       /// Return tuple with number \a i
       Tuple get(int i) const;
+      /// Return newly added compressed tuple
+      Tuple cadd(void);
+      /// Return compressed tuple with number \a i
+      Tuple cget(int i) const;
       /// Set bit \a n in bitset data \a d
       static void set(BitSetData* d, unsigned int n);
       /// Get bit \a n in bitset data \a d
@@ -2217,12 +2264,20 @@ namespace Gecode {
       const Range* fst(int i) const;
       /// Return last range for position \a i
       const Range* lst(int i) const;
+      /// Sort tuples, remove duplicates, and compute hash key
+      GECODE_INT_EXPORT
+      void canonize(void);
       /// Finalize datastructure (disallows additions of more Tuples)
       GECODE_INT_EXPORT
       void finalize(void);
       /// Resize tuple data
       GECODE_INT_EXPORT
       void resize(void);
+      /// Resize compressed tuple data
+      GECODE_INT_EXPORT
+      void cresize(void);
+      /// Whether tuples are in canonical form (implied by finalization)
+      bool canonized(void) const;
       /// Is datastructure finalized
       bool finalized(void) const;
       /// Initialize as empty tuple set with arity \a a
@@ -2239,10 +2294,15 @@ namespace Gecode {
     /// Add tuple \a t to tuple set
     GECODE_INT_EXPORT
     void _add(const IntArgs& t);
+    /// Add compressed tuple with bounds \a l and \a u to tuple set
+    GECODE_INT_EXPORT
+    void _add(const IntArgs& l, const IntArgs& u);
     /// Test whether tuple set is equal to \a t
     GECODE_INT_EXPORT
     bool equal(const TupleSet& t) const;
   public:
+    /// Wildcard entry for compressed tuples
+    static const int star = Int::Limits::infinity;
     /// \name Initialization
     //@{
     /// Construct an unitialized tuple set
@@ -2272,11 +2332,28 @@ namespace Gecode {
 
     /// \name Addition and finalization
     //@{
-    /// Add tuple \a t to tuple set
+    /**
+     * \brief Add tuple \a t to tuple set
+     *
+     * If \a t contains the wildcard star, it is added as a compressed
+     * tuple when the tuple set is finalized.
+     */
     TupleSet& add(const IntArgs& t);
     /// Add tuple with elements \a n, ... to tuple set
     GECODE_INT_EXPORT
     TupleSet& add(int n, ...);
+    /**
+     * \brief Add compressed tuple to tuple set
+     *
+     * The tuple matches all tuples \f$x\f$ with
+     * \f$l_i\leq x_i\leq u_i\f$ for all positions \f$i\f$. If either
+     * \a l[i] or \a u[i] is star, the entry at position \f$i\f$ is a
+     * wildcard.
+     *
+     * Throws an exception of type Int::ArgumentSizeMismatch, if \a l
+     * or \a u do not match the arity of the tuple set.
+     */
+    TupleSet& add(const IntArgs& l, const IntArgs& u);
     /// Is tuple set finalized
     bool finalized(void) const;
     /// Finalize tuple set
@@ -2287,12 +2364,18 @@ namespace Gecode {
     //@{
     /// Arity of tuple set
     int arity(void) const;
-    /// Number of tuples
+    /// Number of (plain) tuples
     int tuples(void) const;
+    /// Number of compressed tuples
+    int compressed(void) const;
     /// Return number of required bit set words
     unsigned int words(void) const;
     /// Get tuple \a i
     Tuple operator [](int i) const;
+    /// Get lower bounds of compressed tuple \a i (wildcards are Int::Limits::min)
+    Tuple lower(int i) const;
+    /// Get upper bounds of compressed tuple \a i (wildcards are Int::Limits::max)
+    Tuple upper(int i) const;
     /// Return minimal value in all tuples
     int min(void) const;
     /// Return maximal value in all tuples
@@ -2307,13 +2390,17 @@ namespace Gecode {
     const Range* fst(int i) const;
     /// Return last range for position \a i
     const Range* lst(int i) const;
-    /// Iterator over ranges
+    /// Iterator over ranges (adjacent ranges are merged)
     class Ranges {
     protected:
       /// Current range
       const Range* c;
+      /// Last range adjacent to the current range
+      const Range* e;
       /// Last range
       const Range* l;
+      /// Move \a e to the last range adjacent to \a c
+      void adjacent(void);
     public:
       /// \name Constructors and initialization
       //@{
@@ -2346,6 +2433,207 @@ namespace Gecode {
 
 #include <gecode/int/extensional/tuple-set.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Process-wide cache for sharing tuple sets and DFAs
+   *
+   * Models often post many extensional constraints with structurally
+   * equal tuple sets or DFAs. Interning returns a handle to a single
+   * shared copy, so that its data (in particular, the supports of a
+   * tuple set) is only computed and stored once.
+   *
+   * The cache is thread-safe. Tuple sets and DFAs that are no longer
+   * referenced outside the cache are evicted when the cache grows, by
+   * ExtensionalCache::evict, and by ExtensionalCache::clear.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  class ExtensionalCache {
+  private:
+    /// Remove entries of map \a c only referenced by the cache
+    template<class Map>
+    static void evict(Map& c);
+  public:
+    /**
+     * \brief Return tuple set equal to \a ts from the cache
+     *
+     * If \a ts is not yet finalized, an equal tuple set from the cache
+     * is returned without computing the supports for \a ts. In that
+     * case, \a ts itself must be finalized before it can be used.
+     *
+     * Throws an exception of type Int::UninitializedTupleSet, if \a ts
+     * has not been initialized.
+     */
+    GECODE_INT_EXPORT
+    static TupleSet intern(const TupleSet& ts);
+    /// Return DFA equal to \a d from the cache
+    GECODE_INT_EXPORT
+    static DFA intern(const DFA& d);
+    /// Return number of cached tuple sets
+    GECODE_INT_EXPORT
+    static unsigned long int tuplesets(void);
+    /// Return number of cached DFAs
+    GECODE_INT_EXPORT
+    static unsigned long int dfas(void);
+    /// Remove tuple sets and DFAs only referenced by the cache
+    GECODE_INT_EXPORT
+    static void evict(void);
+    /// Remove all tuple sets and DFAs from the cache
+    GECODE_INT_EXPORT
+    static void clear(void);
+  };
+
+}
+
+namespace Gecode {
+
+  namespace Int { namespace Extensional {
+    class MDDGraph;
+  }}
+
+  /**
+   * \brief Multi-valued decision diagram (%MDD)
+   *
+   * An %MDD for \f$n\f$ variables is a layered graph: layer \f$0\f$
+   * contains the root node, layer \f$n\f$ the terminal node, and each
+   * arc from a node in layer \f$i\f$ to a node in layer \f$i+1\f$ is
+   * labelled by a value for variable \f$i\f$. A tuple belongs to the
+   * %MDD if its values describe a path from the root to the terminal.
+   *
+   * In contrast to a %DFA, the arcs can differ from layer to layer.
+   * An %MDD is always reduced: nodes that are not on a path from the
+   * root to the terminal are removed and nodes with the same outgoing
+   * arcs are merged. The nodes of each layer are numbered starting
+   * from zero.
+   *
+   * An arc can also be labelled by the wildcard TupleSet::star (for
+   * example, for tuple sets with wildcards): it matches all values for
+   * which its node has no other outgoing arc. When a constraint is
+   * posted, wildcard arcs are replaced by arcs for the values in the
+   * domains of the variables.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  class MDD : public SharedHandle {
+    friend class Int::Extensional::MDDGraph;
+  public:
+    /// Arc of an %MDD
+    class Arc {
+    public:
+      int i_node; ///< Node in layer \f$i\f$
+      int val;    ///< Value for variable \f$i\f$
+      int o_node; ///< Node in layer \f$i+1\f$
+    };
+  protected:
+    /// Data stored for an %MDD
+    class Data;
+    /// Return data
+    Data& data(void) const;
+  public:
+    /**
+     * \brief Initialize from tuple set \a ts
+     *
+     * Throws the following exceptions:
+     *  - Of type Int::NotYetFinalized, if \a ts has not been finalized.
+     *  - Of type Int::TooFewArguments, if the arity of \a ts is zero.
+     */
+    GECODE_INT_EXPORT
+    MDD(const TupleSet& ts);
+    /**
+     * \brief Initialize from words of length \a n of DFA \a d
+     *
+     * Throws an exception of type Int::TooFewArguments, if \f$n<1\f$.
+     */
+    GECODE_INT_EXPORT
+    MDD(const DFA& d, int n);
+    /**
+     * \brief Initialize from %MDD \a m with wildcards replaced by values
+     *
+     * A wildcard arc in layer \a i is replaced by arcs for all values
+     * in \a d[i] for which its node has no other outgoing arc.
+     *
+     * Throws an exception of type Int::ArgumentSizeMismatch, if the
+     * size of \a d does not match the arity of \a m.
+     */
+    GECODE_INT_EXPORT
+    MDD(const MDD& m, const IntSetArgs& d);
+    /// Initialize by %MDD \a m (%MDD is shared)
+    MDD(const MDD& m);
+    /// Test whether %MDD is equal to \a m
+    GECODE_INT_EXPORT
+    bool operator ==(const MDD& m) const;
+    /// Test whether %MDD is not equal to \a m
+    bool operator !=(const MDD& m) const;
+    /// Return the arity (number of layers)
+    int arity(void) const;
+    /// Return the number of nodes in layer \a i
+    int nodes(int i) const;
+    /// Return the total number of nodes
+    int nodes(void) const;
+    /// Return the number of arcs leaving layer \a i
+    int arcs(int i) const;
+    /// Return the total number of arcs
+    int arcs(void) const;
+    /// Return maximal number of nodes in any layer
+    int max_nodes(void) const;
+    /// Return maximal degree (in-degree, out-degree, and number of arcs per value in a layer)
+    unsigned int max_degree(void) const;
+    /// Return smallest value on any arc (not counting wildcards)
+    int symbol_min(void) const;
+    /// Return largest value on any arc (not counting wildcards)
+    int symbol_max(void) const;
+    /// Test whether some arc is labelled by the wildcard TupleSet::star
+    bool wildcards(void) const;
+    /// Return hash key
+    std::size_t hash(void) const;
+
+    /// Iterator for arcs of a layer (sorted by values)
+    class Arcs {
+    private:
+      /// Current arc
+      const Arc* c;
+      /// End of arcs
+      const Arc* e;
+    public:
+      /// Initialize to arcs of layer \a i of %MDD \a m
+      Arcs(const MDD& m, int i);
+      /// Initialize to arcs of layer \a i of %MDD \a m with value \a n
+      Arcs(const MDD& m, int i, int n);
+      /// Test whether iterator still at an arc
+      bool operator ()(void) const;
+      /// Move iterator to next arc
+      void operator ++(void);
+      /// Return node in layer \f$i\f$ of current arc
+      int i_node(void) const;
+      /// Return value of current arc
+      int val(void) const;
+      /// Return node in layer \f$i+1\f$ of current arc
+      int o_node(void) const;
+    };
+    /// Iterator for the values of a layer (sorted and without duplicates)
+    class Values {
+    private:
+      /// Current arc
+      const Arc* c;
+      /// End of arcs
+      const Arc* e;
+    public:
+      /// Initialize to values of layer \a i of %MDD \a m
+      Values(const MDD& m, int i);
+      /// Test whether iterator still at a value
+      bool operator ()(void) const;
+      /// Move iterator to next value
+      void operator ++(void);
+      /// Return current value
+      int val(void) const;
+    };
+  };
+
+}
+
+#include <gecode/int/extensional/mdd.hpp>
+
 namespace Gecode {
 
   /**
@@ -2407,6 +2695,44 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   extensional(Home home, const BoolVarArgs& x, const TupleSet& t,
               IntPropLevel ipl=IPL_DEF);
+
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an MDD
+   *
+   * The elements of \a x must describe a path from the root to the
+   * terminal of the %MDD \a m.
+   *
+   * Throws the following exceptions:
+   *  - Of type Int::ArgumentSizeMismatch, if \a x and \a m are of
+   *    different size.
+   *  - Of type Int::ArgumentSame, if \a x contains the same unassigned
+   *    variable multiply. If shared occurences of variables are
+   *    required, unshare should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
+
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an MDD
+   *
+   * The elements of \a x must describe a path from the root to the
+   * terminal of the %MDD \a m.
+   *
+   * Throws the following exceptions:
+   *  - Of type Int::ArgumentSizeMismatch, if \a x and \a m are of
+   *    different size.
+   *  - Of type Int::ArgumentSame, if \a x contains the same unassigned
+   *    variable multiply. If shared occurences of variables are
+   *    required, unshare should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
 }
 
 namespace Gecode {
@@ -5182,8 +5508,62 @@ namespace Gecode {
   relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx,
         Rnd r, double p);
 
+  /**
+   * \brief Random neighborhood for large neighborhood search
+   *
+   * Relaxes each variable of the array \a x of the space class \a T
+   * with the probability given by the ratio of relaxed variables (see
+   * relax). The class \a VarArray can be IntVarArray or BoolVarArray.
+   *
+   * \ingroup TaskModelInt
+   */
+  template<class T, class VarArray>
+  class RandomNeighborhood : public Search::Neighborhood {
+  protected:
+    /// The variables to be relaxed
+    VarArray T::* x;
+  public:
+    /// Initialize for variables \a x
+    RandomNeighborhood(VarArray T::* x);
+    /// Relax solution \a s in \a home with ratio \a r
+    virtual bool relax(Space& home, const Space& s, double r,
+                       Rnd rnd) const;
+  };
+
+  /**
+   * \brief Propagation-guided neighborhood for large neighborhood search
+   *
+   * Assigns variables of the array \a x of the space class \a T to
+   * their values in the solution, one at a time followed by constraint
+   * propagation, until the ratio of unassigned variables does not
+   * exceed the ratio of relaxed variables. The next variable to be
+   * assigned is the one whose domain has been reduced most (relative
+   * to its size) by the last assignment, or a random variable if no
+   * domain has been reduced. This relaxes variables that are related
+   * by constraints together, see: L. Perron, P. Shaw, V. Furnon,
+   * Propagation guided large neighborhood search, CP 2004.
+   *
+   * The class \a VarArray can be IntVarArray or BoolVarArray.
+   *
+   * \ingroup TaskModelInt
+   */
+  template<class T, class VarArray>
+  class PropagationNeighborhood : public Search::Neighborhood {
+  protected:
+    /// The variables to be relaxed
+    VarArray T::* x;
+  public:
+    /// Initialize for variables \a x
+    PropagationNeighborhood(VarArray T::* x);
+    /// Relax solution \a s in \a home with ratio \a r
+    virtual bool relax(Space& home, const Space& s, double r,
+                       Rnd rnd) const;
+  };
+
 }
 
+#include <gecode/int/lns.hpp>
+
 
 #include <gecode/int/trace/int-trace-view.hpp>
 #include <gecode/int/trace/bool-trace-view.hpp>
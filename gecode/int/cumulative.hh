@@ -688,6 +688,78 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ExecStatus timetabling(Space& home, Propagator& p, Cap c,
                          TaskArray<Task>& t);
 
+  /**
+   * \brief Incremental time-tabling for mandatory tasks
+   *
+   * The profile of compulsory parts is kept between invocations and
+   * is only updated by the compulsory parts that have changed. A task
+   * is only filtered against the profile if its bounds have changed
+   * or if its time window overlaps a part of the profile that has
+   * changed. Hence, no tasks need to be sorted if only few tasks
+   * change between invocations.
+   *
+   * A task of length zero requires capacity at a single point in time
+   * only, which is not captured by a profile of compulsory parts. As
+   * long as some task can have length zero, the full time-tabling
+   * is performed instead.
+   *
+   * Requires \code #include <gecode/int/cumulative.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class ManTask>
+  class TimeTable {
+  protected:
+    /// Information about a task
+    class Info {
+    public:
+      /// Start of compulsory part in profile
+      int cl;
+      /// End of compulsory part in profile
+      int ce;
+      /// Earliest start time when last filtered
+      int est;
+      /// Latest completion time when last filtered
+      int lct;
+      /// Latest start time when last filtered
+      int lst;
+      /// Earliest completion time when last filtered
+      int ect;
+    };
+    /// Step of the profile
+    class Step {
+    public:
+      /// Time when step starts
+      int t;
+      /// Height of profile until the next step
+      int h;
+    };
+    /// Tasks in an order that does not change (views are shared)
+    TaskArray<ManTask> t;
+    /// Information for each task
+    Info* info;
+    /// The profile steps
+    Step* s;
+    /// Number of profile steps
+    int n_s;
+    /// Number of profile steps that can be stored
+    int c_s;
+    /// Capacity when last filtered
+    int cap;
+    /// Filter task \a i against the profile for times \f$[a,b)\f$
+    ExecStatus filter(Space& home, int i, int a, int b);
+  public:
+    /// Default constructor
+    TimeTable(void);
+    /// Initialize for tasks \a t
+    void init(Space& home, const TaskArray<ManTask>& t);
+    /// Update during cloning
+    void update(Space& home, TimeTable<ManTask>& tt);
+    /// Perform propagation for tasks \a t of propagator \a p with capacity \a c
+    template<class Cap>
+    ExecStatus propagate(Space& home, Propagator& p, Cap c,
+                         TaskArray<ManTask>& t);
+  };
+
   /// Propagate by edge-finding
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
@@ -704,6 +776,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Incremental time-tabling (only for basic propagation)
+    TimeTable<ManTask> tt;
     /// Constructor for creation
     ManProp(Home home, Cap c, TaskArray<ManTask>& t);
     /// Constructor for cloning \a p
@@ -40,6 +40,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t)
     : TaskProp<ManTask,PL>(home,t), c(c0) {
     c.subscribe(home,*this,PC_INT_BND);
+    if (PL::basic)
+      tt.init(home,t);
   }
 
   template<class ManTask, class Cap, class PL>
@@ -47,6 +49,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::ManProp(Space& home, ManProp<ManTask,Cap,PL>& p)
     : TaskProp<ManTask,PL>(home,p) {
     c.update(home,p.c);
+    if (PL::basic)
+      tt.update(home,p.tt);
   }
 
   template<class ManTask, class Cap, class PL>
@@ -99,7 +103,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(tt.propagate(home,*this,c,t));
 
     if (Cap::varderived() && c.assigned() && (c.val() == 1)) {
       // Check that tasks do not overload resource
@@ -125,6 +125,236 @@ namespace Gecode { namespace Int { namespace Cumulative {
     return ES_NOFIX;
   }
 
+
+  /// Change of the profile height at some time
+  class ProfileDelta {
+  public:
+    /// Time
+    int t;
+    /// Change of height
+    int d;
+    /// Sort order by time
+    bool operator <(const ProfileDelta& pd) const;
+  };
+
+  forceinline bool
+  ProfileDelta::operator <(const ProfileDelta& pd) const {
+    return t < pd.t;
+  }
+
+  /// Time interval \f$[s,e)\f$ where the profile has changed
+  class ProfileChange {
+  public:
+    /// Start of interval
+    int s;
+    /// End of interval
+    int e;
+    /// Sort order by start
+    bool operator <(const ProfileChange& pc) const;
+  };
+
+  forceinline bool
+  ProfileChange::operator <(const ProfileChange& pc) const {
+    return s < pc.s;
+  }
+
+
+  template<class ManTask>
+  forceinline
+  TimeTable<ManTask>::TimeTable(void)
+    : info(NULL), s(NULL), n_s(0), c_s(0), cap(-1) {}
+
+  template<class ManTask>
+  forceinline void
+  TimeTable<ManTask>::init(Space& home, const TaskArray<ManTask>& t0) {
+    t = TaskArray<ManTask>(home,t0.size());
+    info = home.alloc<Info>(t.size());
+    for (int i=t.size(); i--; ) {
+      t[i] = t0[i];
+      // No compulsory part in profile and never filtered
+      info[i].cl = info[i].ce = Limits::infinity;
+      info[i].est = 1; info[i].lct = 0;
+      info[i].lst = info[i].ect = 0;
+    }
+    s = NULL; n_s = c_s = 0;
+    cap = -1;
+  }
+
+  template<class ManTask>
+  forceinline void
+  TimeTable<ManTask>::update(Space& home, TimeTable<ManTask>& tt) {
+    t.update(home,tt.t);
+    info = home.alloc<Info>(t.size());
+    for (int i=t.size(); i--; )
+      info[i] = tt.info[i];
+    n_s = c_s = tt.n_s;
+    s = (n_s > 0) ? home.alloc<Step>(n_s) : NULL;
+    for (int i=n_s; i--; )
+      s[i] = tt.s[i];
+    cap = tt.cap;
+  }
+
+  template<class ManTask>
+  forceinline ExecStatus
+  TimeTable<ManTask>::filter(Space& home, int i, int a, int b) {
+    // Find first step that ends after a
+    int l=0, h=n_s;
+    while (l < h) {
+      int m = l + ((h-l) >> 1);
+      if (s[m].t <= a)
+        l = m+1;
+      else
+        h = m;
+    }
+    // The compulsory part of the task itself is included in the profile
+    int cl = info[i].cl, ce = info[i].ce;
+    int c = t[i].c();
+    for (int j=std::max(l-1,0); (j < n_s) && (s[j].t < b); j++)
+      if (s[j].h + c > cap) {
+        int f = std::max(s[j].t,a);
+        int e = (j+1 < n_s) ? std::min(s[j+1].t,b) : b;
+        // Task cannot run before or after its own compulsory part
+        if (f < std::min(e,cl))
+          GECODE_ME_CHECK(t[i].norun(home, f, std::min(e,cl) - 1));
+        if (std::max(f,ce) < e)
+          GECODE_ME_CHECK(t[i].norun(home, std::max(f,ce), e - 1));
+      }
+    return ES_OK;
+  }
+
+  template<class ManTask>
+  template<class Cap>
+  ExecStatus
+  TimeTable<ManTask>::propagate(Space& home, Propagator& p, Cap c,
+                                TaskArray<ManTask>& pt) {
+    Region r;
+    int n = t.size();
+
+    // Find tasks with changed compulsory parts
+    int* ch = r.alloc<int>(n);
+    int n_ch = 0;
+    bool assigned = true;
+    for (int i=0; i<n; i++) {
+      if (t[i].pmin() == 0)
+        return timetabling(home,p,c,pt);
+      if (!t[i].assigned())
+        assigned = false;
+      int cl = t[i].lst(), ce = t[i].ect();
+      if (cl >= ce)
+        cl = ce = Limits::infinity;
+      if ((cl != info[i].cl) || (ce != info[i].ce))
+        ch[n_ch++] = i;
+    }
+
+    // Intervals in which the profile has changed
+    ProfileChange* pc = NULL;
+    int n_pc = 0;
+
+    if (n_ch > 0) {
+      pc = r.alloc<ProfileChange>(n_ch);
+      // Changes to the profile
+      ProfileDelta* pd = r.alloc<ProfileDelta>(4*n_ch);
+      int n_pd = 0;
+      for (int k=0; k<n_ch; k++) {
+        int i = ch[k];
+        int cl = t[i].lst(), ce = t[i].ect();
+        if (cl >= ce)
+          cl = ce = Limits::infinity;
+        int ps = Limits::infinity, pe = Limits::min;
+        if (info[i].cl < info[i].ce) {
+          pd[n_pd].t = info[i].cl; pd[n_pd].d = -t[i].c(); n_pd++;
+          pd[n_pd].t = info[i].ce; pd[n_pd].d = t[i].c(); n_pd++;
+          ps = info[i].cl; pe = info[i].ce;
+        }
+        if (cl < ce) {
+          pd[n_pd].t = cl; pd[n_pd].d = t[i].c(); n_pd++;
+          pd[n_pd].t = ce; pd[n_pd].d = -t[i].c(); n_pd++;
+          ps = std::min(ps,cl); pe = std::max(pe,ce);
+        }
+        pc[n_pc].s = ps; pc[n_pc].e = pe; n_pc++;
+        info[i].cl = cl; info[i].ce = ce;
+      }
+      Support::quicksort(pd, n_pd);
+
+      // Merge changes into profile
+      Step* ns = r.alloc<Step>(n_s + n_pd);
+      int m = 0;
+      int hmax = 0;
+      {
+        int j = 0, k = 0;
+        // Height of old profile and accumulated change
+        int ho = 0, hd = 0;
+        while ((j < n_s) || (k < n_pd)) {
+          int tm = (j < n_s) ? s[j].t : Limits::infinity;
+          if ((k < n_pd) && (pd[k].t < tm))
+            tm = pd[k].t;
+          for ( ; (j < n_s) && (s[j].t == tm); j++)
+            ho = s[j].h;
+          for ( ; (k < n_pd) && (pd[k].t == tm); k++)
+            hd += pd[k].d;
+          int h = ho + hd;
+          if (h > c.max())
+            return ES_FAILED;
+          hmax = std::max(hmax,h);
+          if (h != ((m > 0) ? ns[m-1].h : 0)) {
+            ns[m].t = tm; ns[m].h = h; m++;
+          }
+        }
+      }
+      if (m > c_s) {
+        s = home.realloc<Step>(s,c_s,m); c_s = m;
+      }
+      for (int i=m; i--; )
+        s[i] = ns[i];
+      n_s = m;
+      GECODE_ME_CHECK(c.gq(home,hmax));
+
+      // Merge changed intervals
+      Support::quicksort(pc, n_pc);
+      int k = 0;
+      for (int i=1; i<n_pc; i++)
+        if (pc[i].s <= pc[k].e)
+          pc[k].e = std::max(pc[k].e,pc[i].e);
+        else
+          pc[++k] = pc[i];
+      n_pc = k+1;
+    }
+
+    if (assigned)
+      return home.ES_SUBSUMED(p);
+
+    // Filter all tasks if the capacity has changed
+    bool all = (c.max() != cap);
+    cap = c.max();
+
+    for (int i=0; i<n; i++)
+      if (!t[i].assigned()) {
+        int est = t[i].est(), lct = t[i].lct();
+        if (all ||
+            (est != info[i].est) || (lct != info[i].lct) ||
+            (t[i].lst() != info[i].lst) || (t[i].ect() != info[i].ect)) {
+          GECODE_ES_CHECK(filter(home,i,est,lct));
+        } else if (n_pc > 0) {
+          // Find first changed interval that ends after est
+          int l=0, h=n_pc;
+          while (l < h) {
+            int m = l + ((h-l) >> 1);
+            if (pc[m].e <= est)
+              l = m+1;
+            else
+              h = m;
+          }
+          for (int j=l; (j < n_pc) && (pc[j].s < lct); j++)
+            GECODE_ES_CHECK(filter(home,i,std::max(pc[j].s,est),
+                                   std::min(pc[j].e,lct)));
+        }
+        info[i].est = t[i].est(); info[i].lct = t[i].lct();
+        info[i].lst = t[i].lst(); info[i].ect = t[i].ect();
+      }
+
+    return ES_NOFIX;
+  }
+
 }}}
 
 // STATISTICS: int-prop
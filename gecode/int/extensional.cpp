@@ -69,7 +69,7 @@ namespace Gecode {
       throw ArgumentSizeMismatch("Int::extensional");
     GECODE_POST;
 
-    if (t.tuples()==0) {
+    if ((t.tuples()==0) && (t.compressed()==0)) {
       if (x.size()!=0) {
         home.fail();
       }
@@ -93,7 +93,7 @@ namespace Gecode {
       throw NotZeroOne("Int::extensional");
     GECODE_POST;
 
-    if (t.tuples()==0) {
+    if ((t.tuples()==0) && (t.compressed()==0)) {
       if (x.size()!=0) {
         home.fail();
       }
@@ -105,6 +105,48 @@ namespace Gecode {
     GECODE_ES_FAIL(Extensional::postcompact<BoolView>(home,xv,t));
   }
 
+  void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel) {
+    using namespace Int;
+    if (m.arity() != x.size())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (x.same())
+      throw ArgumentSame("Int::extensional");
+    GECODE_POST;
+    if (m.wildcards()) {
+      // Replace wildcards by the values of the variables
+      IntSetArgs d(x.size());
+      for (int i=x.size(); i--; ) {
+        IntVarRanges r(x[i]);
+        d[i] = IntSet(r);
+      }
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,MDD(m,d)));
+    } else {
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,m));
+    }
+  }
+
+  void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel) {
+    using namespace Int;
+    if (m.arity() != x.size())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (x.same())
+      throw ArgumentSame("Int::extensional");
+    GECODE_POST;
+    if (m.wildcards()) {
+      // Replace wildcards by the values of the variables
+      IntSetArgs d(x.size());
+      for (int i=x.size(); i--; )
+        d[i] = IntSet(x[i].min(),x[i].max());
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,MDD(m,d)));
+    } else {
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,m));
+    }
+  }
+
 }
 
 // STATISTICS: int-post
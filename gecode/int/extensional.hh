@@ -57,6 +57,13 @@ namespace Gecode { namespace Int { namespace Extensional {
    *   for Finite Sequences of Variables, CP 2004.
    *   Pages 482-495, LNCS 3258, Springer-Verlag, 2004.
    *
+   * The layered graph can be initialized from a DFA or from an %MDD,
+   * where the latter yields an incremental %MDD propagator along the
+   * lines of:
+   *   Guillaume Perez, Jean-Charles R\'egin, Improving GAC-4 for Table
+   *   and MDD Constraints, CP 2014.
+   *   Pages 606-621, LNCS 8656, Springer-Verlag, 2014.
+   *
    * The propagator is not capable of dealing with multiple occurences
    * of the same view.
    *
@@ -183,16 +190,16 @@ namespace Gecode { namespace Int { namespace Extensional {
     /// Perform consistency check on data structures
     void audit(void);
     /// Initialize layered graph
-    template<class Var>
+    template<class Var, class Graph>
     ExecStatus initialize(Space& home,
-                          const VarArgArray<Var>& x, const DFA& dfa);
+                          const VarArgArray<Var>& x, const Graph& g);
     /// Constructor for cloning \a p
     LayeredGraph(Space& home, LayeredGraph<View,Val,Degree,StateIdx>& p);
   public:
     /// Constructor for posting
-    template<class Var>
+    template<class Var, class Graph>
     LayeredGraph(Home home,
-                 const VarArgArray<Var>& x, const DFA& dfa);
+                 const VarArgArray<Var>& x, const Graph& g);
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
     /// Cost function (defined as high linear)
@@ -205,16 +212,16 @@ namespace Gecode { namespace Int { namespace Extensional {
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
-    /// Post propagator on views \a x and DFA \a dfa
-    template<class Var>
+    /// Post propagator on views \a x and layered graph \a g (DFA or %MDD)
+    template<class Var, class Graph>
     static ExecStatus post(Home home,
-                           const VarArgArray<Var>& x, const DFA& dfa);
+                           const VarArgArray<Var>& x, const Graph& g);
   };
 
   /// Select small types for the layered graph propagator
-  template<class Var>
+  template<class Var, class Graph>
   ExecStatus post_lgp(Home home,
-                      const VarArgArray<Var>& x, const DFA& dfa);
+                      const VarArgArray<Var>& x, const Graph& g);
 
 }}}
 
@@ -226,12 +233,47 @@ namespace Gecode { namespace Int { namespace Extensional {
   /// Import type
   typedef Gecode::Support::BitSetData BitSetData;
 
+  /**
+   * \brief Operations on \a n consecutive words of bit sets
+   *
+   * The operations use AVX-512 or AVX2 instructions if supported by
+   * the processor (as detected at runtime) and operate on one word
+   * at a time otherwise. Operations that modify the words of \a a
+   * return the number of words of \a a that are not zero.
+   */
+  class GECODE_INT_EXPORT DenseWords {
+  public:
+    /// Perform "or" of \a a with \a b
+    static void o(BitSetData* a, const BitSetData* b, unsigned int n);
+    /// Perform "and" of \a a with \a b
+    static unsigned int a(BitSetData* a, const BitSetData* b,
+                          unsigned int n);
+    /// Perform "and" of \a a with the "or" of \a b and \a c
+    static unsigned int ao(BitSetData* a, const BitSetData* b,
+                           const BitSetData* c, unsigned int n);
+    /// Perform "and" of \a a with the negation of \a b
+    static unsigned int nand(BitSetData* a, const BitSetData* b,
+                             unsigned int n);
+    /// Test whether \a a and \a b have a common bit
+    static bool intersects(const BitSetData* a, const BitSetData* b,
+                           unsigned int n);
+  };
+
   /*
    * Forward declarations
    */
   template<unsigned int size> class TinyBitSet;
 
-  /// Bit-set
+  /**
+   * \brief Bit-set
+   *
+   * The bit set starts in dense layout where the \a i th word
+   * corresponds to the \a i th word of the table: then all
+   * operations skip the indirection through the indices and are
+   * performed by DenseWords. Words that become zero are kept in
+   * dense layout. Only when too many words are zero, the zero words
+   * are removed and the bit set continues in sparse layout.
+   */
   template<class IndexType>
   class BitSet {
     template<class> friend class BitSet;
@@ -239,12 +281,16 @@ namespace Gecode { namespace Int { namespace Extensional {
   protected:
     /// Limit
     IndexType _limit;
+    /// Whether the bit set is in dense layout
+    bool dense;
     /// Indices
     IndexType* index;
     /// Words
     BitSetData* bits;
     /// Replace the \a i th word with \a w, decrease \a limit if \a w is zero
     void replace_and_decrease(IndexType i, BitSetData w);
+    /// Update dense layout after an operation leaving \a n non-zero words
+    void update(unsigned int n);
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n);
@@ -437,7 +483,7 @@ namespace Gecode { namespace Int { namespace Extensional {
       /// Return supported value
       int val(void) const;
     };
-    /// Iterator over lost supports
+    /// Iterator over strict supports of lost values
     class LostSupports {
     protected:
       /// Number of words
@@ -481,6 +527,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     const Range* range(CTAdvisor& a, int n);
     /// Return supports for value \a n
     const BitSetData* supports(CTAdvisor& a, int n);
+    /// Return strict supports for value \a n
+    const BitSetData* strict(CTAdvisor& a, int n);
   public:
     /// Delete propagator and return its size
     size_t dispose(Space& home);
@@ -510,6 +558,7 @@ namespace Gecode { namespace Int { namespace Extensional {
     typedef typename Compact<View>::LostSupports LostSupports;
 
     using Compact<View>::supports;
+    using Compact<View>::strict;
     using Compact<View>::unassigned;
     using Compact<View>::status;
     using Compact<View>::c;
@@ -0,0 +1,315 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/extensional.hh>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GECODE_INT_EXTENSIONAL_SIMD
+#include <immintrin.h>
+#endif
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /*
+   * Operations on one word at a time
+   *
+   */
+  static void
+  o_word(BitSetData* a, const BitSetData* b, unsigned int n) {
+    for (unsigned int i=0U; i<n; i++)
+      a[i] = BitSetData::o(a[i],b[i]);
+  }
+
+  static unsigned int
+  a_word(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int nz = 0U;
+    for (unsigned int i=0U; i<n; i++) {
+      a[i] = BitSetData::a(a[i],b[i]);
+      if (!a[i].none())
+        nz++;
+    }
+    return nz;
+  }
+
+  static unsigned int
+  ao_word(BitSetData* a, const BitSetData* b, const BitSetData* c,
+          unsigned int n) {
+    unsigned int nz = 0U;
+    for (unsigned int i=0U; i<n; i++) {
+      a[i] = BitSetData::a(a[i],BitSetData::o(b[i],c[i]));
+      if (!a[i].none())
+        nz++;
+    }
+    return nz;
+  }
+
+  static unsigned int
+  nand_word(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int nz = 0U;
+    for (unsigned int i=0U; i<n; i++) {
+      a[i] = BitSetData::a(a[i],~b[i]);
+      if (!a[i].none())
+        nz++;
+    }
+    return nz;
+  }
+
+  static bool
+  intersects_word(const BitSetData* a, const BitSetData* b, unsigned int n) {
+    for (unsigned int i=0U; i<n; i++)
+      if (!BitSetData::a(a[i],b[i]).none())
+        return true;
+    return false;
+  }
+
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+
+  /*
+   * Operations on four words at a time (AVX2)
+   *
+   */
+#define GECODE_AVX2_LOAD(p) \
+  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+#define GECODE_AVX2_STORE(p,v) \
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),v)
+#define GECODE_AVX2_NONZERO(v)                                          \
+  (4U - static_cast<unsigned int>                                       \
+   (__builtin_popcount(_mm256_movemask_pd                               \
+                       (_mm256_castsi256_pd                             \
+                        (_mm256_cmpeq_epi64(v,_mm256_setzero_si256()))))))
+
+  __attribute__ ((target ("avx2"))) static void
+  o_avx2(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U;
+    for (; i+4U <= n; i += 4U)
+      GECODE_AVX2_STORE(a+i,_mm256_or_si256(GECODE_AVX2_LOAD(a+i),
+                                            GECODE_AVX2_LOAD(b+i)));
+    o_word(a+i,b+i,n-i);
+  }
+
+  __attribute__ ((target ("avx2"))) static unsigned int
+  a_avx2(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U, nz=0U;
+    for (; i+4U <= n; i += 4U) {
+      __m256i v = _mm256_and_si256(GECODE_AVX2_LOAD(a+i),
+                                   GECODE_AVX2_LOAD(b+i));
+      GECODE_AVX2_STORE(a+i,v);
+      nz += GECODE_AVX2_NONZERO(v);
+    }
+    return nz + a_word(a+i,b+i,n-i);
+  }
+
+  __attribute__ ((target ("avx2"))) static unsigned int
+  ao_avx2(BitSetData* a, const BitSetData* b, const BitSetData* c,
+          unsigned int n) {
+    unsigned int i=0U, nz=0U;
+    for (; i+4U <= n; i += 4U) {
+      __m256i v = _mm256_and_si256(GECODE_AVX2_LOAD(a+i),
+                                   _mm256_or_si256(GECODE_AVX2_LOAD(b+i),
+                                                   GECODE_AVX2_LOAD(c+i)));
+      GECODE_AVX2_STORE(a+i,v);
+      nz += GECODE_AVX2_NONZERO(v);
+    }
+    return nz + ao_word(a+i,b+i,c+i,n-i);
+  }
+
+  __attribute__ ((target ("avx2"))) static unsigned int
+  nand_avx2(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U, nz=0U;
+    for (; i+4U <= n; i += 4U) {
+      __m256i v = _mm256_andnot_si256(GECODE_AVX2_LOAD(b+i),
+                                      GECODE_AVX2_LOAD(a+i));
+      GECODE_AVX2_STORE(a+i,v);
+      nz += GECODE_AVX2_NONZERO(v);
+    }
+    return nz + nand_word(a+i,b+i,n-i);
+  }
+
+  __attribute__ ((target ("avx2"))) static bool
+  intersects_avx2(const BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U;
+    for (; i+4U <= n; i += 4U)
+      if (!_mm256_testz_si256(GECODE_AVX2_LOAD(a+i),GECODE_AVX2_LOAD(b+i)))
+        return true;
+    return intersects_word(a+i,b+i,n-i);
+  }
+
+#undef GECODE_AVX2_LOAD
+#undef GECODE_AVX2_STORE
+#undef GECODE_AVX2_NONZERO
+
+  /*
+   * Operations on eight words at a time (AVX-512)
+   *
+   */
+#define GECODE_AVX512_NONZERO(v) \
+  static_cast<unsigned int>(__builtin_popcount(_mm512_test_epi64_mask(v,v)))
+
+  __attribute__ ((target ("avx512f"))) static void
+  o_avx512(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U;
+    for (; i+8U <= n; i += 8U)
+      _mm512_storeu_si512(a+i,_mm512_or_si512(_mm512_loadu_si512(a+i),
+                                              _mm512_loadu_si512(b+i)));
+    o_word(a+i,b+i,n-i);
+  }
+
+  __attribute__ ((target ("avx512f"))) static unsigned int
+  a_avx512(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U, nz=0U;
+    for (; i+8U <= n; i += 8U) {
+      __m512i v = _mm512_and_si512(_mm512_loadu_si512(a+i),
+                                   _mm512_loadu_si512(b+i));
+      _mm512_storeu_si512(a+i,v);
+      nz += GECODE_AVX512_NONZERO(v);
+    }
+    return nz + a_word(a+i,b+i,n-i);
+  }
+
+  __attribute__ ((target ("avx512f"))) static unsigned int
+  ao_avx512(BitSetData* a, const BitSetData* b, const BitSetData* c,
+            unsigned int n) {
+    unsigned int i=0U, nz=0U;
+    for (; i+8U <= n; i += 8U) {
+      __m512i v = _mm512_and_si512(_mm512_loadu_si512(a+i),
+                                   _mm512_or_si512(_mm512_loadu_si512(b+i),
+                                                   _mm512_loadu_si512(c+i)));
+      _mm512_storeu_si512(a+i,v);
+      nz += GECODE_AVX512_NONZERO(v);
+    }
+    return nz + ao_word(a+i,b+i,c+i,n-i);
+  }
+
+  __attribute__ ((target ("avx512f"))) static unsigned int
+  nand_avx512(BitSetData* a, const BitSetData* b, unsigned int n) {
+    unsigned int i=0U, nz=0U;
+    for (; i+8U <= n; i += 8U) {
+      __m512i v = _mm512_and_si512(_mm512_loadu_si512(a+i),
+                                   _mm512_xor_si512(_mm512_loadu_si512(b+i),
+                                                    _mm512_set1_epi64(-1)));
+      _mm512_storeu_si512(a+i,v);
+      nz += GECODE_AVX512_NONZERO(v);
+    }
+    return nz + nand_word(a+i,b+i,n-i);
+  }
+
+  __attribute__ ((target ("avx512f"))) static bool
+  intersects_avx512(const BitSetData* a, const BitSetData* b,
+                    unsigned int n) {
+    unsigned int i=0U;
+    for (; i+8U <= n; i += 8U)
+      if (_mm512_test_epi64_mask(_mm512_loadu_si512(a+i),
+                                 _mm512_loadu_si512(b+i)) != 0)
+        return true;
+    return intersects_word(a+i,b+i,n-i);
+  }
+
+#undef GECODE_AVX512_NONZERO
+
+#endif
+
+  /// Operations selected according to the processor
+  class DenseKernels {
+  public:
+    /// Perform "or"
+    void (*o)(BitSetData*, const BitSetData*, unsigned int);
+    /// Perform "and"
+    unsigned int (*a)(BitSetData*, const BitSetData*, unsigned int);
+    /// Perform "and" with "or"
+    unsigned int (*ao)(BitSetData*, const BitSetData*, const BitSetData*,
+                       unsigned int);
+    /// Perform "and" with negation
+    unsigned int (*nand)(BitSetData*, const BitSetData*, unsigned int);
+    /// Test for common bit
+    bool (*intersects)(const BitSetData*, const BitSetData*, unsigned int);
+    /// Select operations
+    DenseKernels(void);
+  };
+
+  DenseKernels::DenseKernels(void)
+    : o(&o_word), a(&a_word), ao(&ao_word), nand(&nand_word),
+      intersects(&intersects_word) {
+#ifdef GECODE_INT_EXTENSIONAL_SIMD
+    if (sizeof(BitSetData) != 8U)
+      return;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      o = &o_avx512; a = &a_avx512; ao = &ao_avx512; nand = &nand_avx512;
+      intersects = &intersects_avx512;
+    } else if (__builtin_cpu_supports("avx2")) {
+      o = &o_avx2; a = &a_avx2; ao = &ao_avx2; nand = &nand_avx2;
+      intersects = &intersects_avx2;
+    }
+#endif
+  }
+
+  /// The operations for this processor
+  static DenseKernels dk;
+
+
+  /*
+   * Operations on consecutive words
+   *
+   */
+  void
+  DenseWords::o(BitSetData* a, const BitSetData* b, unsigned int n) {
+    dk.o(a,b,n);
+  }
+
+  unsigned int
+  DenseWords::a(BitSetData* a, const BitSetData* b, unsigned int n) {
+    return dk.a(a,b,n);
+  }
+
+  unsigned int
+  DenseWords::ao(BitSetData* a, const BitSetData* b, const BitSetData* c,
+                 unsigned int n) {
+    return dk.ao(a,b,c,n);
+  }
+
+  unsigned int
+  DenseWords::nand(BitSetData* a, const BitSetData* b, unsigned int n) {
+    return dk.nand(a,b,n);
+  }
+
+  bool
+  DenseWords::intersects(const BitSetData* a, const BitSetData* b,
+                         unsigned int n) {
+    return dk.intersects(a,b,n);
+  }
+
+}}}
+
+// STATISTICS: int-prop
+
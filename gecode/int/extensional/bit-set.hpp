@@ -40,7 +40,7 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class IndexType>
   forceinline
   BitSet<IndexType>::BitSet(Space& home, unsigned int n)
-    : _limit(static_cast<IndexType>(n)), 
+    : _limit(static_cast<IndexType>(n)), dense(true),
       index(home.alloc<IndexType>(n)),
       bits(home.alloc<BitSetData>(n)) {
     // Set all bits in all words (including the last)
@@ -55,7 +55,7 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline
   BitSet<IndexType>::BitSet(Space& home,
                             const BitSet<OldIndexType>& bs)
-    : _limit(bs._limit),
+    : _limit(bs._limit), dense(bs.dense),
       index(home.alloc<IndexType>(_limit)),
       bits(home.alloc<BitSetData>(_limit)) {
     assert(_limit > 0U);
@@ -102,6 +102,25 @@ namespace Gecode { namespace Int { namespace Extensional {
     }
   }
 
+  template<class IndexType>
+  forceinline void
+  BitSet<IndexType>::update(unsigned int n) {
+    assert(dense);
+    if (n == 0U) {
+      _limit = 0U;
+    } else if (4U * (static_cast<unsigned int>(_limit) - n) >
+               static_cast<unsigned int>(_limit)) {
+      // More than a quarter of the words are zero: remove them
+      for (IndexType i = _limit; i--; )
+        if (bits[i].none()) {
+          bits[i] = bits[_limit-1];
+          index[i] = index[_limit-1];
+          _limit--;
+        }
+      dense = false;
+    }
+  }
+
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::clear_mask(BitSetData* mask) const {
@@ -116,6 +135,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::add_to_mask(const BitSetData* b, BitSetData* mask) const {
     assert(_limit > 0U);
+    if (dense) {
+      DenseWords::o(mask,b,_limit);
+      return;
+    }
     for (IndexType i = _limit; i--; )
       mask[i] = BitSetData::o(mask[i],b[index[i]]);
   }
@@ -125,7 +148,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
-    if (sparse) {
+    if (dense) {
+      // The mask is indexed the same, regardless of sparse
+      update(DenseWords::a(bits,mask,_limit));
+    } else if (sparse) {
       for (IndexType i = _limit; i--; ) {
         assert(!bits[i].none());
         BitSetData w_i = bits[i];
@@ -149,6 +175,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_limit > 0U);
+    if (dense) {
+      update(DenseWords::ao(bits,a,b,_limit));
+      return;
+    }
     for (IndexType i = _limit; i--; ) {
       assert(!bits[i].none());
       BitSetData w_i = bits[i];
@@ -164,6 +194,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
+    if (dense) {
+      update(DenseWords::nand(bits,b,_limit));
+      return;
+    }
     for (IndexType i = _limit; i--; ) {
       assert(!bits[i].none());
       BitSetData w = BitSetData::a(bits[i],~(b[index[i]]));
@@ -175,6 +209,8 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class IndexType>
   forceinline bool
   BitSet<IndexType>::intersects(const BitSetData* b) const {
+    if (dense)
+      return DenseWords::intersects(bits,b,_limit);
     for (IndexType i = _limit; i--; )
       if (!BitSetData::a(bits[i],b[index[i]]).none())
         return true;
@@ -0,0 +1,177 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int.hh>
+
+#include <unordered_map>
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /// Number of cache entries at which eviction starts
+  const std::size_t cache_limit = 64;
+
+  /// Storage for the tuple set and DFA cache
+  class Cache {
+  public:
+    /// Mutex for synchronizing access
+    Support::Mutex m;
+    /// Tuple sets by hash key
+    std::unordered_multimap<std::size_t,TupleSet> ts;
+    /// DFAs by hash key
+    std::unordered_multimap<std::size_t,DFA> dfa;
+    /// Number of tuple sets at which unused ones are evicted
+    std::size_t ts_limit;
+    /// Number of DFAs at which unused ones are evicted
+    std::size_t dfa_limit;
+    /// Initialize
+    Cache(void) : ts_limit(cache_limit), dfa_limit(cache_limit) {}
+  };
+
+  /// Return the cache (allocated on first use and never deallocated)
+  forceinline Cache&
+  cache(void) {
+    static Cache* c = new Cache;
+    return *c;
+  }
+
+}}}
+
+namespace Gecode {
+
+  template<class Map>
+  forceinline void
+  ExtensionalCache::evict(Map& c) {
+    // Handles are only copied out of the cache while holding the lock,
+    // so an entry that is unique stays unique during eviction
+    for (auto i=c.begin(); i != c.end(); )
+      if (i->second.unique())
+        i = c.erase(i);
+      else
+        ++i;
+  }
+
+  TupleSet
+  ExtensionalCache::intern(const TupleSet& ts) {
+    using namespace Int::Extensional;
+    if (!ts)
+      throw Int::UninitializedTupleSet("ExtensionalCache::intern");
+    Cache& c = cache();
+    Support::Lock l(c.m);
+    TupleSet::Data& d = ts.raw();
+    if (!d.canonized())
+      d.canonize();
+    auto r = c.ts.equal_range(d.key);
+    for (auto i=r.first; i != r.second; ++i) {
+      const TupleSet::Data& e = i->second.raw();
+      if ((d.arity != e.arity) || (d.n_tuples != e.n_tuples) ||
+          (d.n_compressed != e.n_compressed))
+        continue;
+      for (int k=d.n_tuples*d.arity; k--; )
+        if (d.td[k] != e.td[k])
+          goto different;
+      for (int k=2*d.n_compressed*d.arity; k--; )
+        if (d.cd[k] != e.cd[k])
+          goto different;
+      return i->second;
+    different: ;
+    }
+    if (!d.finalized())
+      d.finalize();
+    if (c.ts.size() >= c.ts_limit) {
+      evict(c.ts);
+      c.ts_limit = std::max(cache_limit,2*c.ts.size());
+    }
+    c.ts.insert(std::make_pair(d.key,ts));
+    return ts;
+  }
+
+  DFA
+  ExtensionalCache::intern(const DFA& d) {
+    using namespace Int::Extensional;
+    Cache& c = cache();
+    Support::Lock l(c.m);
+    auto r = c.dfa.equal_range(d.hash());
+    for (auto i=r.first; i != r.second; ++i)
+      if (i->second == d)
+        return i->second;
+    if (c.dfa.size() >= c.dfa_limit) {
+      evict(c.dfa);
+      c.dfa_limit = std::max(cache_limit,2*c.dfa.size());
+    }
+    c.dfa.insert(std::make_pair(d.hash(),d));
+    return d;
+  }
+
+  unsigned long int
+  ExtensionalCache::tuplesets(void) {
+    using namespace Int::Extensional;
+    Cache& c = cache();
+    Support::Lock l(c.m);
+    return static_cast<unsigned long int>(c.ts.size());
+  }
+
+  unsigned long int
+  ExtensionalCache::dfas(void) {
+    using namespace Int::Extensional;
+    Cache& c = cache();
+    Support::Lock l(c.m);
+    return static_cast<unsigned long int>(c.dfa.size());
+  }
+
+  void
+  ExtensionalCache::evict(void) {
+    using namespace Int::Extensional;
+    Cache& c = cache();
+    Support::Lock l(c.m);
+    evict(c.ts);
+    evict(c.dfa);
+    c.ts_limit = std::max(cache_limit,2*c.ts.size());
+    c.dfa_limit = std::max(cache_limit,2*c.dfa.size());
+  }
+
+  void
+  ExtensionalCache::clear(void) {
+    using namespace Int::Extensional;
+    Cache& c = cache();
+    Support::Lock l(c.m);
+    c.ts.clear();
+    c.dfa.clear();
+    c.ts_limit = cache_limit;
+    c.dfa_limit = cache_limit;
+  }
+
+}
+
+// STATISTICS: int-prop
@@ -183,6 +183,23 @@ namespace Gecode { namespace Int { namespace Extensional {
     return fnd->supports(n_words,n);
   }
 
+  template<class View>
+  forceinline const BitSetData*
+  Compact<View>::strict(CTAdvisor& a, int n) {
+    const Range* fnd;
+    const Range* fst=a.fst();
+    const Range* lst=a.lst();
+    if (n <= fst->max) {
+      fnd=fst;
+    } else if (n >= lst->min) {
+      fnd=lst;
+    } else {
+      fnd=range(a,n);
+    }
+    assert((fnd->min <= n) && (n <= fnd->max));
+    return fnd->strict(n_words,n);
+  }
+
   template<class View>
   forceinline
   Compact<View>::ValidSupports::ValidSupports(const Compact<View>& p,
@@ -207,8 +224,14 @@ namespace Gecode { namespace Int { namespace Extensional {
   Compact<View>::ValidSupports::operator ++(void) {
     n++;
     if (n <= xr.max()) {
-      assert(n <= sr->max);
-      s += n_words;
+      if (n > sr->max) {
+        // Adjacent range (only with wildcards)
+        sr++;
+        assert(sr->min == n);
+        s = sr->supports(n_words,n);
+      } else if (!sr->wild) {
+        s += n_words;
+      }
     } else if (n <= max) {
       while (n > xr.max())
         ++xr;
@@ -246,19 +269,34 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline
   Compact<View>::LostSupports::LostSupports
   (const Compact<View>& p, CTAdvisor& a, int l0, int h0)
-    : n_words(p.n_words), r(a.fst()), l(l0), h(h0) {
+    : n_words(p.n_words), r(a.fst()), l(l0), h(h0), s(nullptr) {
     // Move to first value for which there is support
     while (l > r->max)
       r++;
     l=std::max(l,r->min);
-    s=r->supports(n_words,l);
+    // Values only matched by wildcards have no strict supports
+    if (r->wild) {
+      if (r->max >= h) {
+        l=h+1; return;
+      }
+      r++; l=r->min;
+    }
+    s=r->strict(n_words,l);
   }      
   template<class View>
   forceinline void
   Compact<View>::LostSupports::operator ++(void) {
     l++; s += n_words;
     while ((l <= h) && (l > r->max)) {
-      r++; l=r->min; s=r->s;
+      r++;
+      // Values only matched by wildcards have no strict supports
+      if (r->wild) {
+        if (r->max >= h) {
+          l=h+1; return;
+        }
+        r++;
+      }
+      l=r->min; s=r->ss;
     }
   }
   template<class View>
@@ -270,7 +308,7 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline const TupleSet::BitSetData*
   Compact<View>::LostSupports::supports(void) const {
     assert((l >= r->min) && (l <= r->max));
-    assert(s == r->supports(n_words,l));
+    assert(s == r->strict(n_words,l));
     return s;
   }
 
@@ -500,7 +538,7 @@ namespace Gecode { namespace Int { namespace Extensional {
       TupleSet::Ranges r(ts,i);
       GECODE_ME_CHECK(x[i].inter_r(home, r, false));
     }
-    if ((x.size() > 1) && (ts.tuples() > 1)) {
+    if ((x.size() > 1) && (ts.tuples() + ts.compressed() > 1)) {
       CompactTable<View,Table>* ct = new (home) CompactTable(home,x,ts);
       if (ct->table.empty())
         return ES_FAILED;
@@ -536,10 +574,16 @@ namespace Gecode { namespace Int { namespace Extensional {
       return home.ES_NOFIX_DISPOSE(c,a);
     }
 
-    if (!x.any(d) && (x.min(d) == x.max(d))) {
-      table.nand_with_mask(supports(a,x.min(d)));
+    /*
+     * Incremental updates use strict supports, they are not possible
+     * if some compressed tuple has a range of values for x.
+     */
+    bool incremental = !x.any(d) && (a.fst()->ss != nullptr);
+
+    if (incremental && (x.min(d) == x.max(d))) {
+      table.nand_with_mask(strict(a,x.min(d)));
       a.adjust();
-    } else if (!x.any(d) && (x.width(d) <= x.size())) {
+    } else if (incremental && (x.width(d) <= x.size())) {
       // Incremental update, using the removed values
       for (LostSupports ls(*this,a,x.min(d),x.max(d)); ls(); ++ls) {
         table.nand_with_mask(ls.supports());
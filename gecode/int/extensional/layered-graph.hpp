@@ -69,6 +69,128 @@ namespace Gecode { namespace Int { namespace Extensional {
     typedef Int::BoolView View;
   };
 
+  /**
+   * \brief Traits class for layered graphs
+   *
+   * Each graph (DFA or %MDD) must specialize this traits class.
+   */
+  template<class Graph>
+  class GraphTraits {};
+
+  /**
+   * \brief Traits class for layered graphs
+   *
+   * This class specializes the GraphTraits for DFAs, where all layers
+   * are the same.
+   */
+  template<>
+  class GraphTraits<DFA> {
+  public:
+    /// Iterator for transitions of layer \a i with symbol \a n
+    class Transitions : public DFA::Transitions {
+    public:
+      /// Initialize
+      Transitions(const DFA& d, int i, int n);
+    };
+    /// Iterator for symbols of layer \a i
+    class Values : public DFA::Symbols {
+    public:
+      /// Initialize
+      Values(const DFA& d, int i);
+    };
+    /// Return maximal number of states per layer
+    static int states(const DFA& d);
+    /// Return number of first final state
+    static int final_fst(const DFA& d);
+    /// Return number of last final state
+    static int final_lst(const DFA& d);
+    /// Test whether the empty word is accepted
+    static bool empty(const DFA& d);
+  };
+
+  forceinline
+  GraphTraits<DFA>::Transitions::Transitions(const DFA& d, int, int n)
+    : DFA::Transitions(d,n) {}
+  forceinline
+  GraphTraits<DFA>::Values::Values(const DFA& d, int)
+    : DFA::Symbols(d) {}
+  forceinline int
+  GraphTraits<DFA>::states(const DFA& d) {
+    return d.n_states();
+  }
+  forceinline int
+  GraphTraits<DFA>::final_fst(const DFA& d) {
+    return d.final_fst();
+  }
+  forceinline int
+  GraphTraits<DFA>::final_lst(const DFA& d) {
+    return d.final_lst();
+  }
+  forceinline bool
+  GraphTraits<DFA>::empty(const DFA& d) {
+    // Check whether the start state 0 is also a final state
+    return (d.final_fst() <= 0) && (d.final_lst() >= 0);
+  }
+
+  /**
+   * \brief Traits class for layered graphs
+   *
+   * This class specializes the GraphTraits for MDDs, where the only
+   * final state is the terminal node 0.
+   */
+  template<>
+  class GraphTraits<MDD> {
+  public:
+    /// Iterator for transitions of layer \a i with value \a n
+    class Transitions : public MDD::Arcs {
+    public:
+      /// Initialize
+      Transitions(const MDD& m, int i, int n);
+      /// Return in-state of current transition
+      int i_state(void) const;
+      /// Return out-state of current transition
+      int o_state(void) const;
+    };
+    /// Iterator for values of layer \a i
+    typedef MDD::Values Values;
+    /// Return maximal number of states per layer
+    static int states(const MDD& m);
+    /// Return number of first final state
+    static int final_fst(const MDD& m);
+    /// Return number of last final state
+    static int final_lst(const MDD& m);
+    /// Test whether the empty word is accepted
+    static bool empty(const MDD& m);
+  };
+
+  forceinline
+  GraphTraits<MDD>::Transitions::Transitions(const MDD& m, int i, int n)
+    : MDD::Arcs(m,i,n) {}
+  forceinline int
+  GraphTraits<MDD>::Transitions::i_state(void) const {
+    return i_node();
+  }
+  forceinline int
+  GraphTraits<MDD>::Transitions::o_state(void) const {
+    return o_node();
+  }
+  forceinline int
+  GraphTraits<MDD>::states(const MDD& m) {
+    return m.max_nodes();
+  }
+  forceinline int
+  GraphTraits<MDD>::final_fst(const MDD&) {
+    return 0;
+  }
+  forceinline int
+  GraphTraits<MDD>::final_lst(const MDD&) {
+    return 1;
+  }
+  forceinline bool
+  GraphTraits<MDD>::empty(const MDD& m) {
+    return m.arity() == 0;
+  }
+
 
   /*
    * States
@@ -227,13 +349,13 @@ namespace Gecode { namespace Int { namespace Extensional {
    */
 
   template<class View, class Val, class Degree, class StateIdx>
-  template<class Var>
+  template<class Var, class Graph>
   forceinline
   LayeredGraph<View,Val,Degree,StateIdx>::LayeredGraph(Home home,
                                                        const VarArgArray<Var>& x,
-                                                       const DFA& dfa)
+                                                       const Graph& g)
     : Propagator(home), c(home), n(x.size()),
-      max_states(static_cast<StateIdx>(dfa.n_states())) {
+      max_states(static_cast<StateIdx>(GraphTraits<Graph>::states(g))) {
     assert(n > 0);
   }
 
@@ -260,11 +382,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
   template<class View, class Val, class Degree, class StateIdx>
-  template<class Var>
+  template<class Var, class Graph>
   forceinline ExecStatus
   LayeredGraph<View,Val,Degree,StateIdx>::initialize(Space& home,
                                                      const VarArgArray<Var>& x,
-                                                     const DFA& dfa) {
+                                                     const Graph& g) {
 
     Region r;
 
@@ -279,7 +401,7 @@ namespace Gecode { namespace Int { namespace Extensional {
       layers[i].states = states + i*max_states;
 
     // Allocate temporary memory for edges
-    Edge* edges = r.alloc<Edge>(dfa.max_degree());
+    Edge* edges = r.alloc<Edge>(g.max_degree());
 
     // Mark initial state as being reachable
     i_state(0,0).i_deg = 1;
@@ -292,7 +414,8 @@ namespace Gecode { namespace Int { namespace Extensional {
       // Enter links leaving reachable states (indegree != 0)
       for (ViewValues<View> nx(layers[i].x); nx(); ++nx) {
         Degree n_edges=0;
-        for (DFA::Transitions t(dfa,nx.val()); t(); ++t)
+        for (typename GraphTraits<Graph>::Transitions t(g,i,nx.val());
+             t(); ++t)
           if (i_state(i,static_cast<StateIdx>(t.i_state())).i_deg != 0) {
             i_state(i,static_cast<StateIdx>(t.i_state())).o_deg++;
             o_state(i,static_cast<StateIdx>(t.o_state())).i_deg++;
@@ -300,7 +423,7 @@ namespace Gecode { namespace Int { namespace Extensional {
             edges[n_edges].o_state = static_cast<StateIdx>(t.o_state());
             n_edges++;
           }
-        assert(n_edges <= dfa.max_degree());
+        assert(n_edges <= g.max_degree());
         // Found support for value
         if (n_edges > 0) {
           Support& s = layers[i].support[j];
@@ -315,7 +438,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     }
 
     // Mark final states as reachable
-    for (int s=dfa.final_fst(); s<dfa.final_lst(); s++)
+    for (int s=GraphTraits<Graph>::final_fst(g);
+         s<GraphTraits<Graph>::final_lst(g); s++)
       if (o_state(n-1,static_cast<StateIdx>(s)).i_deg != 0)
         o_state(n-1,static_cast<StateIdx>(s)).o_deg = 1;
 
@@ -677,26 +801,22 @@ namespace Gecode { namespace Int { namespace Extensional {
 
 
   template<class View, class Val, class Degree, class StateIdx>
-  template<class Var>
+  template<class Var, class Graph>
   ExecStatus
   LayeredGraph<View,Val,Degree,StateIdx>::post(Home home,
                                                const VarArgArray<Var>& x,
-                                               const DFA& dfa) {
-    if (x.size() == 0) {
-      // Check whether the start state 0 is also a final state
-      if ((dfa.final_fst() <= 0) && (dfa.final_lst() >= 0))
-        return ES_OK;
-      return ES_FAILED;
-    }
+                                               const Graph& g) {
+    if (x.size() == 0)
+      return GraphTraits<Graph>::empty(g) ? ES_OK : ES_FAILED;
     assert(x.size() > 0);
     for (int i=x.size(); i--; ) {
-      DFA::Symbols s(dfa);
+      typename GraphTraits<Graph>::Values s(g,i);
       typename VarTraits<Var>::View xi(x[i]);
       GECODE_ME_CHECK(xi.inter_v(home,s,false));
     }
     LayeredGraph<View,Val,Degree,StateIdx>* p =
-      new (home) LayeredGraph<View,Val,Degree,StateIdx>(home,x,dfa);
-    return p->initialize(home,x,dfa);
+      new (home) LayeredGraph<View,Val,Degree,StateIdx>(home,x,g);
+    return p->initialize(home,x,g);
   }
 
   template<class View, class Val, class Degree, class StateIdx>
@@ -847,16 +967,17 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
   /// Select small types for the layered graph propagator
-  template<class Var>
+  template<class Var, class Graph>
   forceinline ExecStatus
-  post_lgp(Home home, const VarArgArray<Var>& x, const DFA& dfa) {
+  post_lgp(Home home, const VarArgArray<Var>& x, const Graph& g) {
     Gecode::Support::IntType t_state_idx =
-      Gecode::Support::u_type(static_cast<unsigned int>(dfa.n_states()));
+      Gecode::Support::u_type(static_cast<unsigned int>
+                              (GraphTraits<Graph>::states(g)));
     Gecode::Support::IntType t_degree =
-      Gecode::Support::u_type(dfa.max_degree());
+      Gecode::Support::u_type(g.max_degree());
     Gecode::Support::IntType t_val =
-      std::max(Support::s_type(dfa.symbol_min()),
-               Support::s_type(dfa.symbol_max()));
+      std::max(Support::s_type(g.symbol_min()),
+               Support::s_type(g.symbol_max()));
     switch (t_val) {
     case Gecode::Support::IT_CHAR:
     case Gecode::Support::IT_SHRT:
@@ -866,15 +987,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -883,15 +1004,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -900,15 +1021,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned char,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned short int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,short int,unsigned int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -922,15 +1043,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned char>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -939,15 +1060,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned short int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -956,15 +1077,15 @@ namespace Gecode { namespace Int { namespace Extensional {
         case Gecode::Support::IT_CHAR:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned char,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_SHRT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned short int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         case Gecode::Support::IT_INT:
           return Extensional::LayeredGraph
             <typename VarTraits<Var>::View,int,unsigned int,unsigned int>
-            ::post(home,x,dfa);
+            ::post(home,x,g);
         default: GECODE_NEVER;
         }
         break;
@@ -0,0 +1,559 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int.hh>
+
+#include <map>
+#include <vector>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /// Import arc type
+  typedef ::Gecode::MDD::Arc Arc;
+
+  /// Arc comparison by in-node, value, and out-node
+  class ArcByNode {
+  public:
+    /// Comparison of arcs \a a and \a b
+    bool operator ()(const Arc& a, const Arc& b) const;
+  };
+
+  /// Arc comparison by value, in-node, and out-node
+  class ArcByValue {
+  public:
+    /// Comparison of arcs \a a and \a b
+    bool operator ()(const Arc& a, const Arc& b) const;
+  };
+
+  /// Node comparison by outgoing arcs
+  class NodeByArcs {
+  private:
+    /// Arcs sorted by in-node
+    const Arc* a;
+    /// Index of first outgoing arc for each node
+    const int* fst;
+  public:
+    /// Initialize with arcs \a a and index \a fst
+    NodeByArcs(const Arc* a, const int* fst);
+    /// Comparison of nodes \a m and \a n
+    bool operator ()(int m, int n) const;
+    /// Test whether nodes \a m and \a n have the same outgoing arcs
+    bool same(int m, int n) const;
+  };
+
+
+  forceinline bool
+  ArcByNode::operator ()(const Arc& a, const Arc& b) const {
+    return ((a.i_node < b.i_node) ||
+            ((a.i_node == b.i_node) &&
+             ((a.val < b.val) ||
+              ((a.val == b.val) && (a.o_node < b.o_node)))));
+  }
+
+  forceinline bool
+  ArcByValue::operator ()(const Arc& a, const Arc& b) const {
+    return ((a.val < b.val) ||
+            ((a.val == b.val) &&
+             ((a.i_node < b.i_node) ||
+              ((a.i_node == b.i_node) && (a.o_node < b.o_node)))));
+  }
+
+  forceinline
+  NodeByArcs::NodeByArcs(const Arc* a0, const int* fst0)
+    : a(a0), fst(fst0) {}
+
+  forceinline bool
+  NodeByArcs::operator ()(int m, int n) const {
+    int i=fst[m], j=fst[n];
+    while ((i < fst[m+1]) && (j < fst[n+1])) {
+      if (a[i].val != a[j].val)
+        return a[i].val < a[j].val;
+      if (a[i].o_node != a[j].o_node)
+        return a[i].o_node < a[j].o_node;
+      i++; j++;
+    }
+    return (i == fst[m+1]) && (j < fst[n+1]);
+  }
+
+  forceinline bool
+  NodeByArcs::same(int m, int n) const {
+    if (fst[m+1]-fst[m] != fst[n+1]-fst[n])
+      return false;
+    for (int i=fst[m], j=fst[n]; i < fst[m+1]; i++, j++)
+      if ((a[i].val != a[j].val) || (a[i].o_node != a[j].o_node))
+        return false;
+    return true;
+  }
+
+
+  /// Node during construction from a tuple set
+  class Node {
+  public:
+    /// First plain tuple
+    int f;
+    /// Last plain tuple (not included)
+    int l;
+    /// Compressed tuples
+    std::vector<int> cs;
+    /// Initialize with plain tuples [\a f0,\a l0)
+    Node(int f0=0, int l0=0);
+    /// Order nodes
+    bool operator <(const Node& n) const;
+  };
+
+  forceinline
+  Node::Node(int f0, int l0) : f(f0), l(l0) {}
+
+  forceinline bool
+  Node::operator <(const Node& n) const {
+    if (f != n.f)
+      return f < n.f;
+    if (l != n.l)
+      return l < n.l;
+    return cs < n.cs;
+  }
+
+  /// Sort arcs \a a by node and remove duplicates, return number of arcs
+  forceinline int
+  unique(Arc* a, int n) {
+    if (n == 0)
+      return 0;
+    ArcByNode abn;
+    Support::quicksort(a, n, abn);
+    int j=1;
+    for (int i=1; i<n; i++)
+      if ((a[i].i_node != a[j-1].i_node) || (a[i].val != a[j-1].val) ||
+          (a[i].o_node != a[j-1].o_node))
+        a[j++] = a[i];
+    return j;
+  }
+
+  /**
+   * \brief Unreduced layered graph for constructing an %MDD
+   *
+   * Layer \a i has \a n_nodes[i] nodes and the \a n_arcs[i] arcs
+   * \a arcs[i]. The root is node 0 in layer 0.
+   */
+  class MDDGraph {
+  public:
+    /// Number of layers
+    int n;
+    /// Number of nodes per layer
+    int* n_nodes;
+    /// Number of arcs per layer
+    int* n_arcs;
+    /// Arcs per layer
+    Arc** arcs;
+    /// Initialize for \a n0 layers
+    MDDGraph(Region& r, int n0);
+    /**
+     * \brief Reduce the graph
+     *
+     * The array \a t maps the nodes of the last layer to the terminal
+     * (0) or to -1, if the node does not lead to the terminal.
+     */
+    void reduce(Region& r, int* t);
+    /// Create %MDD data from reduced graph
+    SharedHandle::Object* mdd(Region& r) const;
+  };
+
+  forceinline
+  MDDGraph::MDDGraph(Region& r, int n0)
+    : n(n0), n_nodes(r.alloc<int>(n0+1)), n_arcs(r.alloc<int>(n0)),
+      arcs(r.alloc<Arc*>(n0)) {}
+
+  void
+  MDDGraph::reduce(Region& r, int* t) {
+    // Map from nodes in layer i+1 to reduced nodes
+    int* map = t;
+    n_nodes[n] = 1;
+    // Backward pass: remove arcs to dead nodes and merge equal nodes
+    for (int i=n; i--; ) {
+      Arc* a = arcs[i];
+      int k=0;
+      for (int j=0; j<n_arcs[i]; j++)
+        if (map[a[j].o_node] >= 0) {
+          a[k] = a[j]; a[k].o_node = map[a[j].o_node]; k++;
+        }
+      k = unique(a,k);
+      // Index of first arc per node
+      int* fst = r.alloc<int>(n_nodes[i]+1);
+      for (int j=0; j<=n_nodes[i]; j++)
+        fst[j] = 0;
+      for (int j=0; j<k; j++)
+        fst[a[j].i_node+1]++;
+      for (int j=0; j<n_nodes[i]; j++)
+        fst[j+1] += fst[j];
+      // Sort nodes with outgoing arcs by their arcs
+      int* node = r.alloc<int>(n_nodes[i]);
+      int m=0;
+      for (int j=0; j<n_nodes[i]; j++)
+        if (fst[j] < fst[j+1])
+          node[m++] = j;
+      NodeByArcs nba(a,fst);
+      Support::quicksort(node, m, nba);
+      // Map equal nodes to the same node
+      map = r.alloc<int>(n_nodes[i]);
+      for (int j=0; j<n_nodes[i]; j++)
+        map[j] = -1;
+      int l=0;
+      for (int j=0; j<m; j++) {
+        if ((j > 0) && !nba.same(node[j-1],node[j]))
+          l++;
+        map[node[j]] = l;
+      }
+      for (int j=0; j<k; j++)
+        a[j].i_node = map[a[j].i_node];
+      n_arcs[i] = unique(a,k);
+      n_nodes[i] = (m > 0) ? l+1 : 0;
+    }
+    // Forward pass: only keep nodes reachable from the root
+    {
+      int root = map[0];
+      map = r.alloc<int>(std::max(n_nodes[0],1));
+      for (int j=0; j<n_nodes[0]; j++)
+        map[j] = -1;
+      if (root >= 0)
+        map[root] = 0;
+      n_nodes[0] = (root >= 0) ? 1 : 0;
+    }
+    for (int i=0; i<n; i++) {
+      Arc* a = arcs[i];
+      // Map for nodes in next layer
+      int* next = r.alloc<int>(std::max(n_nodes[i+1],1));
+      for (int j=0; j<n_nodes[i+1]; j++)
+        next[j] = -1;
+      int k=0;
+      for (int j=0; j<n_arcs[i]; j++)
+        if (map[a[j].i_node] >= 0) {
+          a[k] = a[j]; a[k].i_node = map[a[j].i_node];
+          next[a[k].o_node] = 0;
+          k++;
+        }
+      n_arcs[i] = k;
+      // Number reachable nodes, keeping their order
+      int l=0;
+      for (int j=0; j<n_nodes[i+1]; j++)
+        if (next[j] == 0)
+          next[j] = l++;
+      n_nodes[i+1] = l;
+      for (int j=0; j<k; j++)
+        a[j].o_node = next[a[j].o_node];
+      map = next;
+    }
+  }
+
+  SharedHandle::Object*
+  MDDGraph::mdd(Region& r) const {
+    const MDDGraph& g = *this;
+    int n_arcs = 0;
+    for (int i=g.n; i--; )
+      n_arcs += g.n_arcs[i];
+    MDD::Data* d = new MDD::Data(g.n,n_arcs);
+    d->key = static_cast<std::size_t>(g.n);
+    int k = 0;
+    bool first = true;
+    for (int i=0; i<g.n; i++) {
+      d->a_fst[i] = k;
+      Arc* a = Heap::copy(d->arcs+k,g.arcs[i],g.n_arcs[i]);
+      ArcByValue abv;
+      Support::quicksort(a, g.n_arcs[i], abv);
+      k += g.n_arcs[i];
+      // Arcs per value
+      for (int j=0; j<g.n_arcs[i]; ) {
+        int l=j++;
+        while ((j<g.n_arcs[i]) && (a[j].val == a[l].val))
+          j++;
+        d->max_degree = std::max(d->max_degree,
+                                 static_cast<unsigned int>(j-l));
+      }
+      // In-degree and out-degree
+      {
+        unsigned int* i_deg = r.alloc<unsigned int>(g.n_nodes[i]+1);
+        unsigned int* o_deg = r.alloc<unsigned int>(g.n_nodes[i+1]+1);
+        for (int j=g.n_nodes[i]; j--; )
+          i_deg[j] = 0U;
+        for (int j=g.n_nodes[i+1]; j--; )
+          o_deg[j] = 0U;
+        for (int j=g.n_arcs[i]; j--; ) {
+          i_deg[a[j].i_node]++; o_deg[a[j].o_node]++;
+        }
+        for (int j=g.n_nodes[i]; j--; )
+          d->max_degree = std::max(d->max_degree,i_deg[j]);
+        for (int j=g.n_nodes[i+1]; j--; )
+          d->max_degree = std::max(d->max_degree,o_deg[j]);
+      }
+      // Wildcard arcs come last as the wildcard is the largest value
+      int n_v = g.n_arcs[i];
+      while ((n_v > 0) && (a[n_v-1].val == TupleSet::star))
+        n_v--;
+      d->wild |= (n_v < g.n_arcs[i]);
+      if (n_v > 0) {
+        if (first) {
+          d->symbol_min = a[0].val;
+          d->symbol_max = a[n_v-1].val;
+          first = false;
+        } else {
+          d->symbol_min = std::min(d->symbol_min,a[0].val);
+          d->symbol_max = std::max(d->symbol_max,a[n_v-1].val);
+        }
+      }
+      cmb_hash(d->key, g.n_nodes[i]);
+      cmb_hash(d->key, g.n_arcs[i]);
+      for (int j=0; j<g.n_arcs[i]; j++) {
+        cmb_hash(d->key, a[j].i_node);
+        cmb_hash(d->key, a[j].val);
+        cmb_hash(d->key, a[j].o_node);
+      }
+    }
+    d->a_fst[g.n] = k;
+    for (int i=0; i<=g.n; i++) {
+      d->n_nodes[i] = g.n_nodes[i];
+      d->max_nodes = std::max(d->max_nodes,g.n_nodes[i]);
+    }
+    cmb_hash(d->key, g.n_nodes[g.n]);
+    return d;
+  }
+
+}}}
+
+namespace Gecode {
+
+  MDD::MDD(const TupleSet& ts) {
+    using namespace Int::Extensional;
+    if (!ts.finalized())
+      throw Int::NotYetFinalized("MDD::MDD");
+    int n = ts.arity();
+    if (n < 1)
+      throw Int::TooFewArguments("MDD::MDD");
+    Region r;
+    MDDGraph g(r,n);
+    /*
+     * The graph is constructed top-down such that it is deterministic:
+     * a node in layer i corresponds to the plain tuples [f,l) that
+     * share a common prefix of length i (they are sorted) together
+     * with the compressed tuples that match the prefix.
+     */
+    std::vector<Node> nodes, next;
+    nodes.push_back(Node(0,ts.tuples()));
+    for (int c=0; c<ts.compressed(); c++)
+      nodes[0].cs.push_back(c);
+    for (int i=0; i<n; i++) {
+      std::map<Node,int> index;
+      std::vector<Arc> arcs;
+      for (int k=0; k<static_cast<int>(nodes.size()); k++) {
+        const Node& p = nodes[k];
+        // Successor nodes by value
+        std::map<int,Node> succ;
+        for (int t=p.f; t<p.l; ) {
+          int v = ts[t][i], f = t;
+          while ((t < p.l) && (ts[t][i] == v))
+            t++;
+          succ[v] = Node(f,t);
+        }
+        // Values of range entries
+        for (int c : p.cs) {
+          int l = ts.lower(c)[i], u = ts.upper(c)[i];
+          if ((l != Int::Limits::min) || (u != Int::Limits::max))
+            for (int v=l; v<=u; v++)
+              (void) succ[v];
+        }
+        // Compressed tuples per value, wildcards also match all other values
+        Node other;
+        for (int c : p.cs) {
+          int l = ts.lower(c)[i], u = ts.upper(c)[i];
+          if ((l == Int::Limits::min) && (u == Int::Limits::max)) {
+            for (std::pair<const int,Node>& s : succ)
+              s.second.cs.push_back(c);
+            other.cs.push_back(c);
+          } else {
+            for (std::map<int,Node>::iterator s=succ.lower_bound(l);
+                 (s != succ.end()) && (s->first <= u); ++s)
+              s->second.cs.push_back(c);
+          }
+        }
+        if (!other.cs.empty())
+          succ.insert(std::make_pair(static_cast<int>(TupleSet::star),
+                                     other));
+        for (const std::pair<const int,Node>& s : succ) {
+          Arc a;
+          a.i_node = k; a.val = s.first; a.o_node = 0;
+          if (i+1 < n) {
+            std::map<Node,int>::iterator j = index.find(s.second);
+            if (j == index.end()) {
+              a.o_node = static_cast<int>(next.size());
+              index[s.second] = a.o_node;
+              next.push_back(s.second);
+            } else {
+              a.o_node = j->second;
+            }
+          }
+          arcs.push_back(a);
+        }
+      }
+      g.n_nodes[i] = static_cast<int>(nodes.size());
+      g.n_arcs[i] = static_cast<int>(arcs.size());
+      g.arcs[i] = r.alloc<Arc>(std::max(g.n_arcs[i],1));
+      for (int j=0; j<g.n_arcs[i]; j++)
+        g.arcs[i][j] = arcs[j];
+      nodes.swap(next); next.clear();
+    }
+    g.n_nodes[n] = 1;
+    // The only node in the last layer is the terminal
+    int* t = r.alloc<int>(1);
+    t[0] = 0;
+    g.reduce(r,t);
+    object(g.mdd(r));
+  }
+
+  MDD::MDD(const DFA& dfa, int n) {
+    using namespace Int::Extensional;
+    if (n < 1)
+      throw Int::TooFewArguments("MDD::MDD");
+    Region r;
+    MDDGraph g(r,n);
+    int n_s = dfa.n_states();
+    // Reachable states in the current layer
+    bool* reach = r.alloc<bool>(n_s);
+    bool* next = r.alloc<bool>(n_s);
+    for (int s=n_s; s--; )
+      reach[s] = false;
+    reach[0] = true;
+    for (int i=0; i<n; i++) {
+      for (int s=n_s; s--; )
+        next[s] = false;
+      int k=0;
+      for (DFA::Transitions t(dfa); t(); ++t)
+        if (reach[t.i_state()])
+          k++;
+      g.arcs[i] = r.alloc<Arc>(std::max(k,1));
+      k=0;
+      for (DFA::Transitions t(dfa); t(); ++t)
+        if (reach[t.i_state()]) {
+          Arc& a = g.arcs[i][k++];
+          a.i_node = t.i_state();
+          a.val = t.symbol();
+          a.o_node = t.o_state();
+          next[t.o_state()] = true;
+        }
+      g.n_arcs[i] = k;
+      g.n_nodes[i] = n_s;
+      std::swap(reach,next);
+    }
+    g.n_nodes[n] = n_s;
+    // Final states lead to the terminal
+    int* t = r.alloc<int>(n_s);
+    for (int s=n_s; s--; )
+      t[s] = ((s >= dfa.final_fst()) && (s < dfa.final_lst())) ? 0 : -1;
+    g.reduce(r,t);
+    object(g.mdd(r));
+  }
+
+  MDD::MDD(const MDD& m, const IntSetArgs& d) {
+    using namespace Int::Extensional;
+    int n = m.arity();
+    if (d.size() != n)
+      throw Int::ArgumentSizeMismatch("MDD::MDD");
+    Region r;
+    MDDGraph g(r,n);
+    for (int i=0; i<n; i++) {
+      std::vector<Arc> arcs;
+      for (Arcs a(m,i); a(); ++a) {
+        Arc b;
+        b.i_node = a.i_node(); b.val = a.val(); b.o_node = a.o_node();
+        arcs.push_back(b);
+      }
+      // Per node, the wildcard arc comes last
+      int n_a = static_cast<int>(arcs.size());
+      if (n_a > 0) {
+        ArcByNode abn;
+        Support::quicksort(&arcs[0], n_a, abn);
+      }
+      for (int f=0; f<n_a; ) {
+        int l=f;
+        while ((l < n_a) && (arcs[l].i_node == arcs[f].i_node))
+          l++;
+        if (arcs[l-1].val == TupleSet::star) {
+          Arc w = arcs[l-1];
+          int j=f;
+          for (IntSetValues v(d[i]); v(); ++v) {
+            while ((j < l-1) && (arcs[j].val < v.val()))
+              j++;
+            if ((j == l-1) || (arcs[j].val != v.val())) {
+              Arc b;
+              b.i_node = w.i_node; b.val = v.val(); b.o_node = w.o_node;
+              arcs.push_back(b);
+            }
+          }
+        }
+        f=l;
+      }
+      int k=0;
+      g.arcs[i] = r.alloc<Arc>(std::max(static_cast<int>(arcs.size()),1));
+      for (const Arc& a : arcs)
+        if (a.val != TupleSet::star)
+          g.arcs[i][k++] = a;
+      g.n_arcs[i] = k;
+      g.n_nodes[i] = m.nodes(i);
+    }
+    g.n_nodes[n] = 1;
+    // The only node in the last layer is the terminal
+    int* t = r.alloc<int>(1);
+    t[0] = 0;
+    g.reduce(r,t);
+    object(g.mdd(r));
+  }
+
+  bool
+  MDD::operator ==(const MDD& m) const {
+    if (object() == m.object())
+      return true;
+    const Data& d = data();
+    const Data& e = m.data();
+    if ((d.n != e.n) || (d.key != e.key))
+      return false;
+    for (int i=0; i<=d.n; i++)
+      if ((d.n_nodes[i] != e.n_nodes[i]) || (d.a_fst[i] != e.a_fst[i]))
+        return false;
+    for (int j=d.a_fst[d.n]; j--; )
+      if ((d.arcs[j].i_node != e.arcs[j].i_node) ||
+          (d.arcs[j].val != e.arcs[j].val) ||
+          (d.arcs[j].o_node != e.arcs[j].o_node))
+        return false;
+    return true;
+  }
+
+}
+
+// STATISTICS: int-prop
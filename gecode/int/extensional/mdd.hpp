@@ -0,0 +1,248 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  /**
+   * \brief Data stored for an %MDD
+   *
+   */
+  class MDD::Data : public SharedHandle::Object {
+  public:
+    /// Arity (number of layers)
+    int n;
+    /// Number of nodes per layer (\a n + 1 entries)
+    int* n_nodes;
+    /// Index of first arc per layer (\a n + 1 entries)
+    int* a_fst;
+    /// Arcs of all layers, per layer sorted by value
+    Arc* arcs;
+    /// Maximal number of nodes in any layer
+    int max_nodes;
+    /// Maximal degree
+    unsigned int max_degree;
+    /// Smallest value
+    int symbol_min;
+    /// Largest value
+    int symbol_max;
+    /// Whether some arc is labelled by a wildcard
+    bool wild;
+    /// Hash key
+    std::size_t key;
+    /// Initialize for arity \a n0 and \a n_arcs arcs
+    Data(int n0, int n_arcs);
+    /// Delete data
+    virtual ~Data(void);
+  };
+
+  forceinline
+  MDD::Data::Data(int n0, int n_arcs)
+    : n(n0), n_nodes(heap.alloc<int>(n0+1)), a_fst(heap.alloc<int>(n0+1)),
+      arcs(heap.alloc<Arc>(n_arcs)), max_nodes(0), max_degree(0U),
+      symbol_min(0), symbol_max(0), wild(false), key(0) {}
+
+  forceinline
+  MDD::Data::~Data(void) {
+    heap.rfree(n_nodes);
+    heap.rfree(a_fst);
+    heap.rfree(arcs);
+  }
+
+
+  /*
+   * MDD
+   *
+   */
+  forceinline
+  MDD::MDD(const MDD& m)
+    : SharedHandle(m) {}
+
+  forceinline MDD::Data&
+  MDD::data(void) const {
+    return *static_cast<Data*>(object());
+  }
+
+  forceinline bool
+  MDD::operator !=(const MDD& m) const {
+    return !(*this == m);
+  }
+
+  forceinline int
+  MDD::arity(void) const {
+    return data().n;
+  }
+  forceinline int
+  MDD::nodes(int i) const {
+    assert((i >= 0) && (i <= arity()));
+    return data().n_nodes[i];
+  }
+  forceinline int
+  MDD::nodes(void) const {
+    int s = 0;
+    for (int i=arity()+1; i--; )
+      s += nodes(i);
+    return s;
+  }
+  forceinline int
+  MDD::arcs(int i) const {
+    assert((i >= 0) && (i < arity()));
+    return data().a_fst[i+1] - data().a_fst[i];
+  }
+  forceinline int
+  MDD::arcs(void) const {
+    return data().a_fst[arity()];
+  }
+  forceinline int
+  MDD::max_nodes(void) const {
+    return data().max_nodes;
+  }
+  forceinline unsigned int
+  MDD::max_degree(void) const {
+    return data().max_degree;
+  }
+  forceinline int
+  MDD::symbol_min(void) const {
+    return data().symbol_min;
+  }
+  forceinline int
+  MDD::symbol_max(void) const {
+    return data().symbol_max;
+  }
+  forceinline bool
+  MDD::wildcards(void) const {
+    return data().wild;
+  }
+  forceinline std::size_t
+  MDD::hash(void) const {
+    return data().key;
+  }
+
+
+  /*
+   * Iterating over arcs
+   *
+   */
+  forceinline
+  MDD::Arcs::Arcs(const MDD& m, int i) {
+    assert((i >= 0) && (i < m.arity()));
+    c = m.data().arcs + m.data().a_fst[i];
+    e = m.data().arcs + m.data().a_fst[i+1];
+  }
+  forceinline
+  MDD::Arcs::Arcs(const MDD& m, int i, int n) {
+    assert((i >= 0) && (i < m.arity()));
+    const Arc* f = m.data().arcs + m.data().a_fst[i];
+    const Arc* l = m.data().arcs + m.data().a_fst[i+1];
+    // Find first arc with value n by binary search
+    while (f < l) {
+      const Arc* mid = f + ((l-f) >> 1);
+      if (mid->val < n)
+        f = mid+1;
+      else
+        l = mid;
+    }
+    c = e = f;
+    const Arc* le = m.data().arcs + m.data().a_fst[i+1];
+    while ((e < le) && (e->val == n))
+      e++;
+  }
+  forceinline bool
+  MDD::Arcs::operator ()(void) const {
+    return c < e;
+  }
+  forceinline void
+  MDD::Arcs::operator ++(void) {
+    c++;
+  }
+  forceinline int
+  MDD::Arcs::i_node(void) const {
+    return c->i_node;
+  }
+  forceinline int
+  MDD::Arcs::val(void) const {
+    return c->val;
+  }
+  forceinline int
+  MDD::Arcs::o_node(void) const {
+    return c->o_node;
+  }
+
+
+  /*
+   * Iterating over values
+   *
+   */
+  forceinline
+  MDD::Values::Values(const MDD& m, int i) {
+    assert((i >= 0) && (i < m.arity()));
+    c = m.data().arcs + m.data().a_fst[i];
+    e = m.data().arcs + m.data().a_fst[i+1];
+  }
+  forceinline bool
+  MDD::Values::operator ()(void) const {
+    return c < e;
+  }
+  forceinline void
+  MDD::Values::operator ++(void) {
+    int n = c->val;
+    do {
+      c++;
+    } while ((c < e) && (c->val == n));
+  }
+  forceinline int
+  MDD::Values::val(void) const {
+    return c->val;
+  }
+
+
+  /**
+   * \brief Print statistics for %MDD \a m
+   * \relates Gecode::MDD
+   */
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os, const MDD& m) {
+    std::basic_ostringstream<Char,Traits> s;
+    s.copyfmt(os); s.width(0);
+    s << "Layers: " << m.arity() << ", nodes: " << m.nodes()
+      << ", arcs: " << m.arcs() << std::endl;
+    for (int i=0; i<m.arity(); i++)
+      s << "\t[" << i << "] nodes: " << m.nodes(i)
+        << ", arcs: " << m.arcs(i) << std::endl;
+    return os << s.str();
+  }
+
+}
+
+// STATISTICS: int-prop
@@ -55,16 +55,11 @@ namespace Gecode { namespace Int { namespace Extensional {
     bool operator ()(const Tuple& a, const Tuple& b);
   };
 
-  /// Tuple comparison by position
-  class PosCompare {
-  private:
-    /// The position of the tuples to compare
-    int p;
+  /// Range comparison by minimum
+  class RangeCompare {
   public:
-    /// Initialize with position \a p
-    PosCompare(int p);
-    /// Comparison of tuples \a a and \a b
-    bool operator ()(const Tuple& a, const Tuple& b);
+    /// Comparison of ranges \a a and \a b
+    bool operator ()(const TupleSet::Range& a, const TupleSet::Range& b);
   };
 
 
@@ -82,12 +77,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
-  forceinline
-  PosCompare::PosCompare(int p0) : p(p0) {}
-
   forceinline bool
-  PosCompare::operator ()(const Tuple& a, const Tuple& b) {
-    return a[p] < b[p];
+  RangeCompare::operator ()(const TupleSet::Range& a,
+                            const TupleSet::Range& b) {
+    return a.min < b.min;
   }
 
 
@@ -100,23 +93,76 @@ namespace Gecode {
    *
    */
   void
-  TupleSet::Data::finalize(void) {
+  TupleSet::Data::canonize(void) {
     using namespace Int::Extensional;
-    assert(!finalized());
-    // Mark as finalized
-    n_free = -1;
+    assert(!canonized());
+
+    // Move tuples with wildcards to compressed tuples
+    {
+      int j=0;
+      for (int t=0; t<n_tuples; t++) {
+        Tuple p = td + t*arity;
+        for (int a=arity; a--; )
+          if (p[a] == star)
+            goto wildcard;
+        if (j != t)
+          Heap::copy(td + j*arity, p, arity);
+        j++;
+        continue;
+      wildcard:
+        Tuple c = cadd();
+        for (int a=arity; a--; )
+          if (p[a] == star) {
+            c[a] = Int::Limits::min; c[arity+a] = Int::Limits::max;
+          } else {
+            c[a] = c[arity+a] = p[a];
+          }
+      }
+      n_free += n_tuples - j;
+      n_tuples = j;
+    }
+    // Expand compressed tuples matching a single tuple, drop empty ones
+    {
+      int j=0;
+      for (int t=0; t<n_compressed; t++) {
+        Tuple c = cd + 2*t*arity;
+        bool single = true;
+        for (int a=arity; a--; ) {
+          if (c[a] > c[arity+a])
+            goto empty;
+          if ((c[a] < Int::Limits::min) || (c[arity+a] > Int::Limits::max))
+            throw Int::OutOfLimits("TupleSet::finalize()");
+          single &= (c[a] == c[arity+a]);
+        }
+        if (single) {
+          Tuple p = add();
+          Heap::copy(p, cd + 2*t*arity, arity);
+        } else {
+          if (j != t)
+            Heap::copy(cd + 2*j*arity, c, 2*arity);
+          j++;
+        }
+      empty: ;
+      }
+      n_cfree += n_compressed - j;
+      n_compressed = j;
+    }
+
+    // Mark as canonical
+    n_free = -2;
 
     // Initialization
-    if (n_tuples == 0) {
-      delete td; td=nullptr;
+    if ((n_tuples == 0) && (n_compressed == 0)) {
+      heap.rfree(td); td=nullptr;
+      heap.rfree(cd); cd=nullptr;
       return;
     }
 
     // Compact and copy data
     Region r;
     // Set up tuple pointers
-    Tuple* tuple = r.alloc<Tuple>(n_tuples);
-    {
+    Tuple* tuple = r.alloc<Tuple>(std::max(n_tuples,n_compressed));
+    if (n_tuples > 0) {
       for (int t=n_tuples; t--; )
         tuple[t] = td + t*arity;
       TupleCompare tc(arity);
@@ -134,56 +180,168 @@ namespace Gecode {
       }
       assert(j <= n_tuples);
       n_tuples=j;
-      // Initialize hash key
-      key = static_cast<std::size_t>(n_tuples);
-      cmb_hash(key, arity);
       // Copy into now possibly smaller area
       int* new_td = heap.alloc<int>(n_tuples*arity);
-      for (int t=n_tuples; t--; ) {
-        for (int a=arity; a--; ) {
+      for (int t=n_tuples; t--; )
+        for (int a=arity; a--; )
           new_td[t*arity+a] = tuple[t][a];
-          cmb_hash(key,tuple[t][a]);
-        }
-        tuple[t] = new_td + t*arity;
-      }
       heap.rfree(td);
       td = new_td;
+    } else {
+      heap.rfree(td); td=nullptr;
     }
-    
+    if (n_compressed > 0) {
+      for (int t=n_compressed; t--; )
+        tuple[t] = cd + 2*t*arity;
+      TupleCompare tc(2*arity);
+      Support::quicksort(tuple, n_compressed, tc);
+      // Remove duplicates
+      int j=1;
+      for (int t=1; t<n_compressed; t++) {
+        for (int a=2*arity; a--; )
+          if (tuple[t-1][a] != tuple[t][a])
+            goto cnotsame;
+        goto csame;
+      cnotsame: ;
+        tuple[j++] = tuple[t];
+      csame: ;
+      }
+      assert(j <= n_compressed);
+      n_compressed=j;
+      // Copy into now possibly smaller area
+      int* new_cd = heap.alloc<int>(2*n_compressed*arity);
+      for (int t=n_compressed; t--; )
+        for (int a=2*arity; a--; )
+          new_cd[2*t*arity+a] = tuple[t][a];
+      heap.rfree(cd);
+      cd = new_cd;
+    }
+    n_cfree = 0;
+    // Initialize hash key
+    key = static_cast<std::size_t>(n_tuples);
+    cmb_hash(key, arity);
+    cmb_hash(key, n_compressed);
+    for (int i=n_tuples*arity; i--; )
+      cmb_hash(key, td[i]);
+    for (int i=2*n_compressed*arity; i--; )
+      cmb_hash(key, cd[i]);
+    assert(canonized());
+  }
+
+  void
+  TupleSet::Data::finalize(void) {
+    using namespace Int::Extensional;
+    assert(!finalized());
+    if (!canonized())
+      canonize();
+    // Mark as finalized
+    n_free = -1;
+
+    // Initialization
+    if ((n_tuples == 0) && (n_compressed == 0))
+      return;
+
+    Region r;
     // Only now compute how many tuples are needed!
-    n_words = BitSetData::data(n_tuples);
+    n_words = BitSetData::data(n_tuples + n_compressed);
 
     // Compute range information
     {
       /*
-       * Pass one: compute how many values and ranges are needed
+       * Pass one: compute ranges from the values and range entries
        */
-      // How many values
+      // Whether a position has wildcards
+      bool* wild = r.alloc<bool>(arity);
+      // Whether a position has range entries
+      bool* rng = r.alloc<bool>(arity);
+      // How many values (in multiples of words)
       unsigned int n_vals = 0U;
       // How many ranges
       unsigned int n_ranges = 0U;
+      // Whether empty strict supports are needed for wildcard ranges
+      bool none = false;
+      // Intervals (values and range entries) for a position
+      Range* iv = r.alloc<Range>(n_tuples + n_compressed);
+      // Ranges including ranges for values only matched by wildcards
+      Range* wr = r.alloc<Range>(2U*(n_tuples + n_compressed) + 1U);
       for (int a=arity; a--; ) {
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
-        // Scan values
-        {
-          int max=tuple[0][a];
-          n_vals++; n_ranges++;
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (max+1 == tuple[i][a]) {
-              n_vals++;
-              max=tuple[i][a];
-            } else if (max+1 < tuple[i][a]) {
-              n_vals++; n_ranges++;
-              max=tuple[i][a];
+        wild[a] = rng[a] = false;
+        unsigned int n_iv = 0U;
+        for (int t=0; t<n_tuples; t++) {
+          iv[n_iv].min = iv[n_iv].max = td[t*arity+a];
+          n_iv++;
+        }
+        for (int t=0; t<n_compressed; t++) {
+          int l = cd[2*t*arity+a], u = cd[2*t*arity+arity+a];
+          if ((l == Int::Limits::min) && (u == Int::Limits::max)) {
+            wild[a] = true;
+          } else {
+            rng[a] |= (l < u);
+            iv[n_iv].min = l; iv[n_iv].max = u;
+            n_iv++;
+          }
+        }
+        assert(wild[a] || (n_iv > 0U));
+        // Compress into non-overlapping ranges
+        unsigned int n_r = 0U;
+        if (n_iv > 0U) {
+          RangeCompare rc;
+          Support::quicksort(iv, n_iv, rc);
+          unsigned int j=0U;
+          for (unsigned int i=1U; i<n_iv; i++) {
+            assert(iv[i-1U].min <= iv[i].min);
+            if (static_cast<long long int>(iv[j].max)+1 >= iv[i].min) {
+              iv[j].max = std::max(iv[j].max,iv[i].max);
             } else {
-              assert(max == tuple[i][a]);
+              iv[++j] = iv[i];
             }
           }
+          n_r = j+1U;
+          // Update min and max
+          min = std::min(min,iv[0].min);
+          max = std::max(max,iv[n_r-1U].max);
+        }
+        for (unsigned int i=0U; i<n_r; i++)
+          iv[i].wild = false;
+        // A wildcard matches any value: cover all values without entries
+        if (wild[a]) {
+          unsigned int k=0U;
+          int l = Int::Limits::min;
+          for (unsigned int i=0U; i<n_r; i++) {
+            if (l < iv[i].min) {
+              wr[k].min = l; wr[k].max = iv[i].min-1; wr[k].wild = true;
+              k++;
+            }
+            wr[k++] = iv[i];
+            l = iv[i].max+1;
+          }
+          if ((n_r == 0U) || (iv[n_r-1U].max < Int::Limits::max)) {
+            wr[k].min = l; wr[k].max = Int::Limits::max; wr[k].wild = true;
+            k++;
+          }
+          vd[a].n = k;
+          vd[a].r = Heap::copy(r.alloc<Range>(k),wr,k);
+        } else {
+          vd[a].n = n_r;
+          vd[a].r = Heap::copy(r.alloc<Range>(n_r),iv,n_r);
+        }
+        n_ranges += vd[a].n;
+        unsigned int n = 0U;
+        for (unsigned int i=0U; i<vd[a].n; i++)
+          if (!vd[a].r[i].wild)
+            n += vd[a].r[i].width();
+        // Separate strict supports are needed for wildcards only
+        n_vals += (wild[a] && !rng[a]) ? 2U*n : n;
+        // Supports shared by all values only matched by wildcards
+        if (wild[a]) {
+          n_vals++;
+          none |= !rng[a];
         }
       }
+      if (none)
+        n_vals++;
+      if ((min < Int::Limits::min) || (max > Int::Limits::max))
+        throw Int::OutOfLimits("TupleSet::finalize()");
       /*
        * Pass 2: allocate memory and fill data structures
        */
@@ -193,53 +351,83 @@ namespace Gecode {
       BitSetData* cs = support = heap.alloc<BitSetData>(n_words * n_vals);
       for (unsigned int i=n_vals * n_words; i--; )
         cs[i].init();
+      // Empty strict supports
+      BitSetData* ns = nullptr;
+      if (none) {
+        ns = cs; cs += n_words;
+      }
       for (int a=arity; a--; ) {
         // Set range pointer
-        vd[a].r = cr;
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
-        // Update min and max
-        min = std::min(min,tuple[0][a]);
-        max = std::max(max,tuple[n_tuples-1][a]);
-        // Compress into non-overlapping ranges
-        {
-          unsigned int j=0U;
-          vd[a].r[0].max=vd[a].r[0].min=tuple[0][a];
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (vd[a].r[j].max+1 == tuple[i][a]) {
-              vd[a].r[j].max=tuple[i][a];
-            } else if (vd[a].r[j].max+1 < tuple[i][a]) {
-              j++; vd[a].r[j].min=vd[a].r[j].max=tuple[i][a];
-            } else {
-              assert(vd[a].r[j].max == tuple[i][a]);
-            }
-          }
-          vd[a].n = j+1U;
-          cr += j+1U;
+        vd[a].r = Heap::copy(cr,vd[a].r,vd[a].n);
+        cr += vd[a].n;
+        // Supports for values only matched by wildcards
+        BitSetData* ws = nullptr;
+        if (wild[a]) {
+          ws = cs; cs += n_words;
         }
-        // Set support pointer and set bits
-        for (unsigned int i=0U; i<vd[a].n; i++) {
-          vd[a].r[i].s = cs;
-          cs += n_words * vd[a].r[i].width();
+        // Set support pointers
+        for (unsigned int i=0U; i<vd[a].n; i++)
+          if (vd[a].r[i].wild) {
+            vd[a].r[i].s = ws;
+          } else {
+            vd[a].r[i].s = cs;
+            cs += n_words * vd[a].r[i].width();
+          }
+        for (unsigned int i=0U; i<vd[a].n; i++)
+          if (rng[a]) {
+            vd[a].r[i].ss = nullptr;
+          } else if (vd[a].r[i].wild) {
+            vd[a].r[i].ss = ns;
+          } else if (wild[a]) {
+            vd[a].r[i].ss = cs;
+            cs += n_words * vd[a].r[i].width();
+          } else {
+            vd[a].r[i].ss = vd[a].r[i].s;
+          }
+        // Whether strict supports must be set separately
+        bool sep = wild[a] && !rng[a];
+        // Set bits for plain tuples
+        for (int t=0; t<n_tuples; t++) {
+          int v = td[t*arity+a];
+          const Range& c = vd[a].r[vd[a].start(v)];
+          assert(!c.wild);
+          set(const_cast<BitSetData*>(c.supports(n_words,v)),
+              static_cast<unsigned int>(t));
+          if (sep)
+            set(const_cast<BitSetData*>(c.strict(n_words,v)),
+                static_cast<unsigned int>(t));
         }
-        {
-          int j=0;
-          for (int i=0; i<n_tuples; i++) {
-            while (tuple[i][a] > vd[a].r[j].max)
-              j++;
-            set(const_cast<BitSetData*>
-                (vd[a].r[j].supports(n_words,tuple[i][a])),
-                tuple2idx(tuple[i]));
+        // Set bits for compressed tuples
+        for (int t=0; t<n_compressed; t++) {
+          unsigned int k = static_cast<unsigned int>(n_tuples + t);
+          int l = cd[2*t*arity+a], u = cd[2*t*arity+arity+a];
+          if ((l == Int::Limits::min) && (u == Int::Limits::max)) {
+            set(ws, k);
+            for (unsigned int i=0U; i<vd[a].n; i++)
+              if (!vd[a].r[i].wild)
+                for (int v=vd[a].r[i].min; v<=vd[a].r[i].max; v++)
+                  set(const_cast<BitSetData*>
+                      (vd[a].r[i].supports(n_words,v)), k);
+          } else {
+            for (unsigned int i=vd[a].start(l);
+                 (i<vd[a].n) && (vd[a].r[i].min <= u); i++) {
+              assert(!vd[a].r[i].wild);
+              for (int v=std::max(l,vd[a].r[i].min);
+                   v<=std::min(u,vd[a].r[i].max); v++)
+                set(const_cast<BitSetData*>
+                    (vd[a].r[i].supports(n_words,v)), k);
+            }
+            if (sep) {
+              assert(l == u);
+              set(const_cast<BitSetData*>
+                  (vd[a].r[vd[a].start(l)].strict(n_words,l)), k);
+            }
           }
         }
       }
       assert(cs == support + n_words * n_vals);
       assert(cr == range + n_ranges);
     }
-    if ((min < Int::Limits::min) || (max > Int::Limits::max))
-      throw Int::OutOfLimits("TupleSet::finalize()");
     assert(finalized());
   }
 
@@ -251,8 +439,17 @@ namespace Gecode {
     n_free = n - n_tuples;
   }
 
+  void
+  TupleSet::Data::cresize(void) {
+    assert(n_cfree == 0);
+    int n = static_cast<int>(1+n_compressed*1.5);
+    cd = heap.realloc<int>(cd, 2 * n_compressed * arity, 2 * n * arity);
+    n_cfree = n - n_compressed;
+  }
+
   TupleSet::Data::~Data(void) {
     heap.rfree(td);
+    heap.rfree(cd);
     heap.rfree(vd);
     heap.rfree(range);
     heap.rfree(support);
@@ -449,10 +646,15 @@ namespace Gecode {
     assert(arity() == t.arity());
     assert(min() == t.min());
     assert(max() == t.max());
+    assert(compressed() == t.compressed());
     for (int i=tuples(); i--; )
       for (int j=arity(); j--; )
         if ((*this)[i][j] != t[i][j])
           return false;
+    for (int i=compressed(); i--; )
+      for (int j=arity(); j--; )
+        if ((lower(i)[j] != t.lower(i)[j]) || (upper(i)[j] != t.upper(i)[j]))
+          return false;
     return true;
   }
 
@@ -460,7 +662,7 @@ namespace Gecode {
   TupleSet::_add(const IntArgs& t) {
     if (!*this)
       throw Int::UninitializedTupleSet("TupleSet::add()");
-    if (raw().finalized())
+    if (raw().canonized())
       throw Int::AlreadyFinalized("TupleSet::add()");
     if (t.size() != raw().arity)
       throw Int::ArgumentSizeMismatch("TupleSet::add()");
@@ -469,11 +671,29 @@ namespace Gecode {
       a[i]=t[i];
   }
 
+  void
+  TupleSet::_add(const IntArgs& l, const IntArgs& u) {
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::add()");
+    if (raw().canonized())
+      throw Int::AlreadyFinalized("TupleSet::add()");
+    if ((l.size() != raw().arity) || (u.size() != raw().arity))
+      throw Int::ArgumentSizeMismatch("TupleSet::add()");
+    Tuple c = raw().cadd();
+    int a = raw().arity;
+    for (int i=a; i--; )
+      if ((l[i] == star) || (u[i] == star)) {
+        c[i] = Int::Limits::min; c[a+i] = Int::Limits::max;
+      } else {
+        c[i] = l[i]; c[a+i] = u[i];
+      }
+  }
+
   TupleSet&
   TupleSet::add(int n, ...) {
     if (!*this)
       throw Int::UninitializedTupleSet("TupleSet::add()");
-    if (raw().finalized())
+    if (raw().canonized())
       throw Int::AlreadyFinalized("TupleSet::add()");
     Tuple t = raw().add();
     va_list args;
@@ -43,13 +43,20 @@ namespace Gecode {
    */
   forceinline unsigned int
   TupleSet::Range::width(void) const {
-    return static_cast<unsigned int>(max - min + 1);
+    return static_cast<unsigned int>(max) - static_cast<unsigned int>(min)
+      + 1U;
   }
 
   forceinline const TupleSet::BitSetData*
   TupleSet::Range::supports(unsigned int n_words, int n) const {
     assert((min <= n) && (n <= max));
-    return s + n_words * static_cast<unsigned int>(n - min);
+    return wild ? s : s + n_words * static_cast<unsigned int>(n - min);
+  }
+
+  forceinline const TupleSet::BitSetData*
+  TupleSet::Range::strict(unsigned int n_words, int n) const {
+    assert((min <= n) && (n <= max) && (ss != nullptr));
+    return wild ? ss : ss + n_words * static_cast<unsigned int>(n - min);
   }
 
   
@@ -60,18 +67,23 @@ namespace Gecode {
   forceinline
   TupleSet::Data::Data(int a) 
     : arity(a), n_words(0U), // To be initialized in finalize
-      n_tuples(0), n_free(n_initial_free),
+      n_tuples(0), n_free(n_initial_free), n_compressed(0), n_cfree(0),
       min(Int::Limits::max), max(Int::Limits::min), key(0),
-      td(heap.alloc<int>(n_initial_free * a)),
+      td(heap.alloc<int>(n_initial_free * a)), cd(nullptr),
       vd(heap.alloc<ValueData>(a)),
       range(nullptr), support(nullptr) {
   }
   
   forceinline bool
-  TupleSet::Data::finalized(void) const {
+  TupleSet::Data::canonized(void) const {
     return n_free < 0;
   }
 
+  forceinline bool
+  TupleSet::Data::finalized(void) const {
+    return n_free == -1;
+  }
+
   forceinline TupleSet::Tuple
   TupleSet::Data::add(void) {
     if (n_free == 0)
@@ -89,6 +101,23 @@ namespace Gecode {
     return td + i*arity;
   }
 
+  forceinline TupleSet::Tuple
+  TupleSet::Data::cadd(void) {
+    if (n_cfree == 0)
+      cresize();
+    assert(n_cfree > 0);
+    n_cfree--;
+    Tuple t = cd + 2*n_compressed*arity;
+    n_compressed++;
+    return t;
+  }
+
+  forceinline TupleSet::Tuple
+  TupleSet::Data::cget(int i) const {
+    assert((i >= 0) && (i < n_compressed));
+    return cd + 2*i*arity;
+  }
+
   forceinline unsigned int
   TupleSet::ValueData::start(int k) const {
     if (n > 1U) {
@@ -143,6 +172,11 @@ namespace Gecode {
     _add(t); return *this;
   }
 
+  forceinline TupleSet&
+  TupleSet::add(const IntArgs& l, const IntArgs& u) {
+    _add(l,u); return *this;
+  }
+
   forceinline
   TupleSet::TupleSet(void) {}
 
@@ -185,6 +219,10 @@ namespace Gecode {
   TupleSet::tuples(void) const {
     return raw().n_tuples;
   }
+  forceinline int
+  TupleSet::compressed(void) const {
+    return raw().n_compressed;
+  }
   forceinline unsigned int
   TupleSet::words(void) const {
     return data().n_words;
@@ -201,6 +239,14 @@ namespace Gecode {
   TupleSet::operator [](int i) const {
     return data().get(i);
   }
+  forceinline TupleSet::Tuple
+  TupleSet::lower(int i) const {
+    return data().cget(i);
+  }
+  forceinline TupleSet::Tuple
+  TupleSet::upper(int i) const {
+    return data().cget(i) + arity();
+  }
   forceinline const TupleSet::Range*
   TupleSet::fst(int i) const {
     return data().fst(i);
@@ -214,6 +260,8 @@ namespace Gecode {
   TupleSet::operator ==(const TupleSet& t) const {
     if (tuples() != t.tuples())
       return false;
+    if (compressed() != t.compressed())
+      return false;
     if (arity() != t.arity())
       return false;
     if (min() != t.min())
@@ -234,16 +282,20 @@ namespace Gecode {
   operator <<(std::basic_ostream<Char,Traits>& os, const TupleSet& ts) {
     std::basic_ostringstream<Char,Traits> s;
     s.copyfmt(os); s.width(0);
-    s << "Number of tuples: " << ts.tuples() 
-      << " (number of words: " << ts.words() << " with " 
+    s << "Number of tuples: " << ts.tuples();
+    if (ts.compressed() > 0)
+      s << " (compressed: " << ts.compressed() << ")";
+    s << " (number of words: " << ts.words() << " with " 
       << Support::BitSetData::bpb << " bits)" << std::endl;
     for (int a=0; a < ts.arity(); a++) {
       unsigned int size = 0U;
       for (const TupleSet::Range* c=ts.fst(a); c<=ts.lst(a); c++)
-        size += c->width();
+        if (!c->wild)
+          size += c->width();
       s << "\t[" << a << "] size: " << size
         << ", width: " 
-        << static_cast<unsigned int>(ts.lst(a)->max - ts.fst(a)->min + 1)
+        << (static_cast<unsigned int>(ts.lst(a)->max) -
+            static_cast<unsigned int>(ts.fst(a)->min) + 1U)
         << ", ranges: "
         << (ts.lst(a) - ts.fst(a) + 1U)
         << std::endl;
@@ -256,10 +308,19 @@ namespace Gecode {
    * Range iterator
    *
    */
+  forceinline void
+  TupleSet::Ranges::adjacent(void) {
+    e = c;
+    while ((e+1 < l) && ((e+1)->min == e->max+1))
+      e++;
+  }
+
   forceinline
   TupleSet::Ranges::Ranges(const TupleSet& ts, int i) {
     c = &(ts.data().vd[i].r[0]);
     l = c + ts.data().vd[i].n;
+    if (c < l)
+      adjacent();
   }
 
   forceinline bool
@@ -268,7 +329,9 @@ namespace Gecode {
   }
   forceinline void
   TupleSet::Ranges::operator ++(void) {
-    c++;
+    c = e+1;
+    if (c < l)
+      adjacent();
   }
 
   forceinline int
@@ -277,11 +340,12 @@ namespace Gecode {
   }
   forceinline int
   TupleSet::Ranges::max(void) const {
-    return c->max;
+    return e->max;
   }
   forceinline unsigned int
   TupleSet::Ranges::width(void) const {
-    return c->width();
+    return static_cast<unsigned int>(e->max) -
+      static_cast<unsigned int>(c->min) + 1U;
   }
 
 }
@@ -0,0 +1,114 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  template<class T, class VarArray>
+  forceinline
+  RandomNeighborhood<T,VarArray>::RandomNeighborhood(VarArray T::* x0)
+    : x(x0) {}
+
+  template<class T, class VarArray>
+  bool
+  RandomNeighborhood<T,VarArray>::relax(Space& home, const Space& s,
+                                        double r, Rnd rnd) const {
+    typedef typename ArrayTraits<VarArray>::ArgsType VarArgs;
+    if (r >= 1.0)
+      return true;
+    VarArgs hx(static_cast<T&>(home).*x);
+    VarArgs sx(static_cast<const T&>(s).*x);
+    Gecode::relax(home,hx,sx,rnd,r);
+    return false;
+  }
+
+
+  template<class T, class VarArray>
+  forceinline
+  PropagationNeighborhood<T,VarArray>::PropagationNeighborhood
+  (VarArray T::* x0)
+    : x(x0) {}
+
+  template<class T, class VarArray>
+  bool
+  PropagationNeighborhood<T,VarArray>::relax(Space& home, const Space& s,
+                                             double r, Rnd rnd) const {
+    VarArray& hx = static_cast<T&>(home).*x;
+    const VarArray& sx = static_cast<const T&>(s).*x;
+    int n = hx.size();
+    // Number of variables to be assigned
+    int m = static_cast<int>((1.0 - r) * n);
+    if (m <= 0)
+      return true;
+    Region reg;
+    // Domain sizes before the last assignment
+    unsigned int* d = reg.alloc<unsigned int>(n);
+    for (int i=0; i<n; i++)
+      d[i] = hx[i].size();
+    while (true) {
+      // Number of assigned variables and of candidates
+      int a = 0, c = 0;
+      // Candidate with largest relative domain reduction
+      int b = -1; double br = 0.0;
+      for (int i=0; i<n; i++)
+        if (hx[i].assigned()) {
+          a++;
+        } else if (sx[i].assigned()) {
+          c++;
+          double ri = 1.0 - static_cast<double>(hx[i].size()) / d[i];
+          if (ri > br) {
+            b = i; br = ri;
+          }
+        }
+      if ((a >= m) || (c == 0))
+        break;
+      if (b < 0) {
+        // No domain has been reduced, choose a random candidate
+        int k = static_cast<int>(rnd(static_cast<unsigned int>(c)));
+        for (int i=0; i<n; i++)
+          if (!hx[i].assigned() && sx[i].assigned() && (k-- == 0)) {
+            b = i; break;
+          }
+      }
+      for (int i=0; i<n; i++)
+        d[i] = hx[i].size();
+      rel(home, hx[b], IRT_EQ, sx[b].val());
+      if (home.status() == SS_FAILED)
+        break;
+    }
+    return false;
+  }
+
+}
+
+// STATISTICS: int-other
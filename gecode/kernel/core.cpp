@@ -82,6 +82,10 @@ namespace Gecode {
   NoGoods::post(Space&) const {
   }
 
+  void
+  NoGoods::archive(Archive&) const {
+  }
+
   NoGoods NoGoods::eng;
 
   /*
@@ -813,6 +817,15 @@ namespace Gecode {
   Space::constrain(const Space&) {
   }
 
+  bool
+  Space::objective(long long int&) const {
+    return false;
+  }
+
+  void
+  Space::bound(long long int) {
+  }
+
   bool
   Space::master(const MetaInfo& mi) {
     switch (mi.type()) {
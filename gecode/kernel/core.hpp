@@ -1554,6 +1554,9 @@ namespace Gecode {
     /// Post no-goods
     GECODE_KERNEL_EXPORT
     virtual void post(Space& home) const;
+    /// Archive no-goods into \a e (does nothing by default)
+    GECODE_KERNEL_EXPORT
+    virtual void archive(Archive& e) const;
     /// Return number of no-goods posted
     unsigned long int ng(void) const;
     /// %Set number of no-goods posted to \a n
@@ -1990,6 +1993,30 @@ namespace Gecode {
      * \ingroup TaskModelScript
      */
     GECODE_KERNEL_EXPORT virtual void constrain(const Space& best);
+    /**
+     * \brief Return objective value for best solution search
+     *
+     * If the space has a numerical objective, store its value (to
+     * be minimized) in \a o and return true. Then search engines
+     * can constrain spaces by bound (see bound) instead of using
+     * a copy of the so far best solution.
+     *
+     * The default function returns false.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual bool objective(long long int& o) const;
+    /**
+     * \brief Constrain objective to be less than \a o
+     *
+     * Constraining by bound \a o must be equivalent to constraining
+     * by a solution with objective value \a o (see objective).
+     *
+     * The default function does nothing.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT virtual void bound(long long int o);
     /**
      * \brief Master configuration function for meta search engines
      *
@@ -2557,6 +2584,8 @@ namespace Gecode {
      * The first list element to be retuned is \a f, the last is \a l.
      */
     template<size_t> void  fl_dispose(FreeList* f, FreeList* l);
+    /// Return amount of heap memory (in bytes) requested by the space
+    size_t allocated(void) const;
     //@}
     /// Construction routines
     //@{
@@ -2602,6 +2631,19 @@ namespace Gecode {
     T& construct(A1 const& a1, A2 const& a2, A3 const& a3, A4 const& a4, A5 const& a5);
     //@}
 
+    /// \name Memory policy
+    //@{
+    /**
+     * \brief %Set memory policy to \a p
+     *
+     * The memory policy is shared among a space and all its clones.
+     * It should be set for the root space before search starts.
+     */
+    void memory_policy(const MemoryPolicy& p);
+    /// Return memory policy
+    const MemoryPolicy& memory_policy(void) const;
+    //@}
+
     /// \name Low-level support for AFC
     //@{
     /// %Set AFC decay factor to \a d
@@ -2760,6 +2802,10 @@ namespace Gecode {
   Space::rfree(void* p, size_t s) {
     return mm.reuse(p,s);
   }
+  forceinline size_t
+  Space::allocated(void) const {
+    return mm.allocated();
+  }
   forceinline void*
   Space::rrealloc(void* _b, size_t n, size_t m) {
     char* b = static_cast<char*>(_b);
@@ -2769,7 +2815,7 @@ namespace Gecode {
       rfree(b,n);
       return p;
     } else {
-      rfree(b+m,m-n);
+      rfree(b+m,n-m);
       return b;
     }
   }
@@ -2852,7 +2898,7 @@ namespace Gecode {
       free<T>(b,n);
       return p;
     } else {
-      free<T>(b+m,m-n);
+      free<T>(b+m,n-m);
       return b;
     }
   }
@@ -3195,6 +3241,16 @@ namespace Gecode {
     _trycommit(c,a);
   }
 
+  forceinline void
+  Space::memory_policy(const MemoryPolicy& p) {
+    ssd.data().sm.policy(p);
+  }
+
+  forceinline const MemoryPolicy&
+  Space::memory_policy(void) const {
+    return ssd.data().sm.policy();
+  }
+
   forceinline double
   Space::afc_decay(void) const {
     return ssd.data().gpi.decay();
@@ -3442,7 +3498,7 @@ namespace Gecode {
 
   forceinline double
   Propagator::afc(void) const {
-    return const_cast<Propagator&>(*this).gpi().afc;
+    return const_cast<Propagator&>(*this).gpi().value();
   }
 
 #ifdef GECODE_HAS_CBS
@@ -77,6 +77,9 @@ namespace Gecode {
   IllegalDecay::IllegalDecay(const char* l)
     : Exception(l,"Illegal decay factor") {}
 
+  IllegalMemoryPolicy::IllegalMemoryPolicy(const char* l)
+    : Exception(l,"Illegal memory policy") {}
+
   InvalidFunction::InvalidFunction(const char* l)
     : Exception(l,"Invalid function") {}
 
@@ -110,6 +110,13 @@ namespace Gecode {
     IllegalDecay(const char* l);
   };
 
+  /// %Exception: illegal memory policy
+  class GECODE_KERNEL_EXPORT IllegalMemoryPolicy : public Exception {
+  public:
+    /// Initialize with location \a l
+    IllegalMemoryPolicy(const char* l);
+  };
+
   /// %Exception: invalid function
   class GECODE_KERNEL_EXPORT InvalidFunction : public Exception {
   public:
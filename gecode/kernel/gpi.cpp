@@ -37,6 +37,16 @@ namespace Gecode { namespace Kernel {
 
   Support::Mutex GPI::m;
 
+  void
+  GPI::rescale(Info& c) {
+    m.acquire();
+    // Another thread might have rescaled already
+    if (c.value() > Kernel::Config::rescale_limit)
+      for (Block* i = b; i != NULL; i = i->next)
+        i->rescale();
+    m.release();
+  }
+
 }}
 
 // STATISTICS: kernel-prop
@@ -32,6 +32,7 @@
  */
 
 #include <cmath>
+#include <atomic>
 
 namespace Gecode { namespace Kernel {
 
@@ -45,10 +46,16 @@ namespace Gecode { namespace Kernel {
       unsigned int pid;
       /// Group identifier
       unsigned int gid;
-      /// The afc value
-      double afc;
+      /// The afc value (updated without locking)
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
+      /// Return the afc value
+      double value(void) const;
+      /// Atomically update afc value to \f$d\cdot(\mathit{afc}+1)\f$ and return it
+      double inc(double d);
+      /// Atomically scale the afc value by \a s
+      void scale(double s);
     };
   private:
     /// Block of propagator information
@@ -70,15 +77,23 @@ namespace Gecode { namespace Kernel {
     /// The current block
     Block* b;
     /// The inverse decay factor
-    double invd;
+    std::atomic<double> invd;
     /// Next free propagator id
     unsigned int pid;
     /// Whether to unshare
     bool us;
     /// The first block
     Block fst;
-    /// Mutex to synchronize globally shared access
+    /**
+     * \brief Mutex to synchronize globally shared access
+     *
+     * The mutex protects allocation of information entries and
+     * rescaling. Failure counting itself does not acquire the mutex
+     * as the afc values are updated atomically.
+     */
     GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// Rescale all afc values if \a c still exceeds the rescale limit
+    GECODE_KERNEL_EXPORT void rescale(Info& c);
   public:
     /// Initialize
     GPI(void);
@@ -101,7 +116,25 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc.store(1.0,std::memory_order_relaxed);
+  }
+  forceinline double
+  GPI::Info::value(void) const {
+    return afc.load(std::memory_order_relaxed);
+  }
+  forceinline double
+  GPI::Info::inc(double d) {
+    double o = afc.load(std::memory_order_relaxed);
+    double n;
+    do {
+      n = d * (o + 1.0);
+    } while (!afc.compare_exchange_weak(o,n,std::memory_order_relaxed));
+    return n;
+  }
+  forceinline void
+  GPI::Info::scale(double s) {
+    double o = afc.load(std::memory_order_relaxed);
+    while (!afc.compare_exchange_weak(o,s*o,std::memory_order_relaxed)) {}
   }
 
 
@@ -112,7 +145,7 @@ namespace Gecode { namespace Kernel {
   forceinline void
   GPI::Block::rescale(void) {
     for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+      info[i].scale(Kernel::Config::rescale);
   }
 
 
@@ -122,21 +155,14 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::fail(Info& c) {
-    m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
-      for (Block* i = b; i != NULL; i = i->next)
-        i->rescale();
-    m.release();
+    if (c.inc(invd.load(std::memory_order_relaxed)) >
+        Kernel::Config::rescale_limit)
+      rescale(c);
   }
 
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline bool
@@ -150,9 +176,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
@@ -45,6 +45,14 @@ namespace Gecode { namespace Kernel {
      * \brief How many heap chunks should be cached at most
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief How many heap chunks should be cached at most per thread
+     *
+     * Only heap chunks not exceeding the maximal chunk size of the
+     * memory policy are cached per thread, larger chunks are passed
+     * to the shared cache.
+     */
+    const unsigned int n_hc_thread_cache = 4*2;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
@@ -33,11 +33,210 @@
 
 #include <gecode/kernel.hh>
 
+#include <atomic>
+
+namespace Gecode {
+
+  /*
+   * Memory policy
+   *
+   */
+
+  MemoryPolicy::MemoryPolicy(size_t hcsz_min0, size_t hcsz_max0,
+                             unsigned int hcsz_inc_ratio0,
+                             unsigned int hcsz_dec_ratio0)
+    : _hcsz_min(hcsz_min0), _hcsz_max(hcsz_max0),
+      _hcsz_inc_ratio(hcsz_inc_ratio0), _hcsz_dec_ratio(hcsz_dec_ratio0) {
+    if ((_hcsz_min < Kernel::MemoryConfig::hcsz_min) ||
+        (_hcsz_max < _hcsz_min) ||
+        (_hcsz_inc_ratio == 0U) || (_hcsz_dec_ratio == 0U))
+      throw IllegalMemoryPolicy("MemoryPolicy::MemoryPolicy");
+  }
+
+  MemoryPolicy
+  MemoryPolicy::large(void) {
+    return MemoryPolicy(64 * 1024, 2 * 1024 * 1024, 2U, 8U);
+  }
+
+}
+
 namespace Gecode { namespace Kernel {
 
-  Support::Mutex& SharedMemory::m(void) {
-    static Support::Mutex _m;
-    return _m;
+  /*
+   * Heap chunk statistics
+   *
+   */
+
+  namespace {
+    /// Number of heap chunks reused from thread-local caches
+    std::atomic<unsigned long int> n_local(0UL);
+    /// Number of heap chunks reused from shared caches
+    std::atomic<unsigned long int> n_shared(0UL);
+    /// Number of heap chunks allocated from the heap
+    std::atomic<unsigned long int> n_allocated(0UL);
+    /// Number of heap chunks returned to the heap
+    std::atomic<unsigned long int> n_released(0UL);
+  }
+
+
+  /*
+   * Thread-local heap chunk cache
+   *
+   */
+
+  /// Cache of heap chunks owned by a single thread
+  class HeapChunkCache {
+  public:
+    /// Number of cached heap chunks
+    unsigned int n_hc;
+    /// A list of cached heap chunks
+    HeapChunk* hc;
+    /// Number of reused heap chunks not yet accounted for globally
+    unsigned long int n_reused;
+    /// Initialize
+    HeapChunkCache(void);
+    /// Return cached heap chunk of size at least \a l or NULL
+    HeapChunk* alloc(size_t l);
+    /// Try to cache heap chunk \a c if not larger than \a u
+    bool free(HeapChunk* c, size_t u);
+    /// Account for reused heap chunks globally
+    void flush(void);
+    /// Return all cached heap chunks to the heap
+    ~HeapChunkCache(void);
+  };
+
+  forceinline
+  HeapChunkCache::HeapChunkCache(void)
+    : n_hc(0U), hc(NULL), n_reused(0UL) {}
+
+  forceinline HeapChunk*
+  HeapChunkCache::alloc(size_t l) {
+    HeapChunk* p = NULL;
+    HeapChunk* c = hc;
+    while (c != NULL) {
+      if (c->size >= l) {
+        if (p == NULL)
+          hc = static_cast<HeapChunk*>(c->next);
+        else
+          p->next = c->next;
+        n_hc--; n_reused++;
+        return c;
+      }
+      p = c; c = static_cast<HeapChunk*>(c->next);
+    }
+    return NULL;
+  }
+
+  forceinline bool
+  HeapChunkCache::free(HeapChunk* c, size_t u) {
+    if ((n_hc == MemoryConfig::n_hc_thread_cache) || (c->size > u))
+      return false;
+    n_hc++;
+    c->next = hc; hc = c;
+    return true;
+  }
+
+  forceinline void
+  HeapChunkCache::flush(void) {
+    if (n_reused > 0UL) {
+      n_local.fetch_add(n_reused,std::memory_order_relaxed);
+      n_reused = 0UL;
+    }
+  }
+
+  HeapChunkCache::~HeapChunkCache(void) {
+    flush();
+    n_released.fetch_add(n_hc,std::memory_order_relaxed);
+    while (hc != NULL) {
+      HeapChunk* c = hc;
+      hc = static_cast<HeapChunk*>(c->next);
+      Gecode::heap.rfree(c);
+    }
+    // Bypass the cache should chunks be freed during program termination
+    n_hc = MemoryConfig::n_hc_thread_cache;
+  }
+
+  namespace {
+    /// The heap chunk cache of the current thread
+    thread_local HeapChunkCache hcc;
+  }
+
+
+  /*
+   * Shared memory area
+   *
+   */
+
+  SharedMemory::~SharedMemory(void) {
+    n_released.fetch_add(heap.n_hc,std::memory_order_relaxed);
+    while (heap.hc != NULL) {
+      HeapChunk* hc = heap.hc;
+      heap.hc = static_cast<HeapChunk*>(hc->next);
+      Gecode::heap.rfree(hc);
+    }
+  }
+
+  HeapChunk*
+  SharedMemory::alloc(size_t s, size_t l) {
+    if (HeapChunk* hc = hcc.alloc(l))
+      return hc;
+    hcc.flush();
+    unsigned long int n_free = 0UL;
+    HeapChunk* hc;
+    m.acquire();
+    while ((heap.hc != NULL) && (heap.hc->size < l)) {
+      heap.n_hc--; n_free++;
+      HeapChunk* c = heap.hc;
+      heap.hc = static_cast<HeapChunk*>(c->next);
+      Gecode::heap.rfree(c);
+    }
+    if (heap.hc == NULL) {
+      assert(heap.n_hc == 0);
+      hc = NULL;
+    } else {
+      heap.n_hc--;
+      hc = heap.hc;
+      heap.hc = static_cast<HeapChunk*>(hc->next);
+    }
+    m.release();
+    if (n_free > 0UL)
+      n_released.fetch_add(n_free,std::memory_order_relaxed);
+    if (hc != NULL) {
+      n_shared.fetch_add(1UL,std::memory_order_relaxed);
+    } else {
+      hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+      hc->size = s;
+      n_allocated.fetch_add(1UL,std::memory_order_relaxed);
+    }
+    return hc;
+  }
+
+  void
+  SharedMemory::free(HeapChunk* hc) {
+    if (hcc.free(hc,mp.hcsz_max()))
+      return;
+    hcc.flush();
+    m.acquire();
+    if (heap.n_hc == MemoryConfig::n_hc_cache) {
+      m.release();
+      Gecode::heap.rfree(hc);
+      n_released.fetch_add(1UL,std::memory_order_relaxed);
+    } else {
+      heap.n_hc++;
+      hc->next = heap.hc; heap.hc = hc;
+      m.release();
+    }
+  }
+
+  SharedMemory::Statistics
+  SharedMemory::statistics(void) {
+    hcc.flush();
+    Statistics s;
+    s.local     = n_local.load(std::memory_order_relaxed);
+    s.shared    = n_shared.load(std::memory_order_relaxed);
+    s.allocated = n_allocated.load(std::memory_order_relaxed);
+    s.released  = n_released.load(std::memory_order_relaxed);
+    return s;
   }
 
   void
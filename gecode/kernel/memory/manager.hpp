@@ -38,6 +38,72 @@
  *
  */
 
+namespace Gecode {
+
+  /**
+   * \brief Policy for requesting heap chunks for spaces
+   *
+   * A memory policy defines the sizes of heap chunks requested by
+   * spaces. The default policy follows the parameters in
+   * Gecode::Kernel::MemoryConfig which are tuned for small spaces.
+   * For spaces using several megabytes, a policy with larger chunks
+   * reduces the number of chunk requests when cloning.
+   *
+   * A memory policy is set for a root space with
+   * Space::memory_policy() and is shared by all of its clones.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class MemoryPolicy {
+  protected:
+    /// Minimal heap chunk size
+    size_t _hcsz_min;
+    /// Maximal heap chunk size
+    size_t _hcsz_max;
+    /// Increment ratio for heap chunk size
+    unsigned int _hcsz_inc_ratio;
+    /// Decrement ratio for heap chunk size
+    unsigned int _hcsz_dec_ratio;
+  public:
+    /// Initialize with the defaults from Gecode::Kernel::MemoryConfig
+    MemoryPolicy(void);
+    /**
+     * \brief Initialize policy
+     *
+     * Heap chunk sizes range from \a hcsz_min to \a hcsz_max. If a
+     * space has requested \a hcsz_inc_ratio chunks of the current
+     * size, the size is doubled. If a space to be cloned has requested
+     * less than \a hcsz_dec_ratio chunks of the current size, the size
+     * for the clone is halved.
+     *
+     * Throws an exception of type Gecode::IllegalMemoryPolicy, if
+     * \a hcsz_min is smaller than Gecode::Kernel::MemoryConfig::hcsz_min,
+     * \a hcsz_max is smaller than \a hcsz_min, or if one of the ratios
+     * is zero.
+     */
+    GECODE_KERNEL_EXPORT
+    MemoryPolicy(size_t hcsz_min, size_t hcsz_max,
+                 unsigned int hcsz_inc_ratio=8U,
+                 unsigned int hcsz_dec_ratio=8U);
+    /// Return minimal heap chunk size
+    size_t hcsz_min(void) const;
+    /// Return maximal heap chunk size
+    size_t hcsz_max(void) const;
+    /// Return increment ratio for heap chunk size
+    unsigned int hcsz_inc_ratio(void) const;
+    /// Return decrement ratio for heap chunk size
+    unsigned int hcsz_dec_ratio(void) const;
+    /**
+     * \brief Return policy for large spaces
+     *
+     * Heap chunks range from 64KB to 2MB (the size of a large page on
+     * many platforms) and grow quickly.
+     */
+    GECODE_KERNEL_EXPORT static MemoryPolicy large(void);
+  };
+
+}
+
 namespace Gecode { namespace Kernel {
 
   /// Memory chunk with size information
@@ -56,8 +122,30 @@ namespace Gecode { namespace Kernel {
     double area[1];
   };
 
-  /// Shared object for several memory areas
+  /**
+   * \brief Shared object for several memory areas
+   *
+   * Heap chunks are first returned to a small cache local to the
+   * thread releasing them (at most MemoryConfig::n_hc_thread_cache
+   * chunks not exceeding the maximal chunk size of the memory
+   * policy). Only if the thread-local cache is full or cannot serve a
+   * request, the shared cache (at most MemoryConfig::n_hc_cache
+   * chunks) is accessed, which requires synchronization.
+   */
   class SharedMemory {
+  public:
+    /// Statistics for heap chunk management accumulated over all threads
+    class Statistics {
+    public:
+      /// Number of heap chunks reused from thread-local caches
+      unsigned long int local;
+      /// Number of heap chunks reused from shared caches
+      unsigned long int shared;
+      /// Number of heap chunks allocated from the heap
+      unsigned long int allocated;
+      /// Number of heap chunks returned to the heap
+      unsigned long int released;
+    };
   private:
     /// The components for shared heap memory
     struct {
@@ -66,20 +154,37 @@ namespace Gecode { namespace Kernel {
       /// A list of cached heap chunks
       HeapChunk* hc;
     } heap;
-    /// A mutex for access
-    GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    /// A mutex for access to the shared cache
+    Support::FastMutex m;
+    /// The memory policy
+    MemoryPolicy mp;
   public:
     /// Initialize
     SharedMemory(void);
     /// Destructor
-    ~SharedMemory(void);
+    GECODE_KERNEL_EXPORT ~SharedMemory(void);
     /// \name Heap management
     //@
     /// Return heap chunk, preferable of size \a s, but at least of size \a l
-    HeapChunk* alloc(size_t s, size_t l);
+    GECODE_KERNEL_EXPORT HeapChunk* alloc(size_t s, size_t l);
     /// Free heap chunk (or cache for later)
-    void free(HeapChunk* hc);
+    GECODE_KERNEL_EXPORT void free(HeapChunk* hc);
     //@}
+    /// \name Memory policy
+    //@{
+    /// Return memory policy
+    const MemoryPolicy& policy(void) const;
+    /// %Set memory policy to \a p
+    void policy(const MemoryPolicy& p);
+    //@}
+    /**
+     * \brief Return heap chunk statistics
+     *
+     * Reuse of chunks from the thread-local cache of a thread other
+     * than the calling thread is only accounted for after that thread
+     * has accessed a shared cache.
+     */
+    GECODE_KERNEL_EXPORT static Statistics statistics(void);
   };
 
 
@@ -145,6 +250,8 @@ namespace Gecode { namespace Kernel {
     void* alloc(SharedMemory& sm, size_t s);
     /// Get the memory area for subscriptions
     void* subscriptions(void) const;
+    /// Return total amount of heap memory requested
+    size_t allocated(void) const;
 
   private:
     /// Start of free lists
@@ -173,6 +280,39 @@ namespace Gecode { namespace Kernel {
 
 }}
 
+namespace Gecode {
+
+  /*
+   * Memory policy
+   *
+   */
+
+  forceinline
+  MemoryPolicy::MemoryPolicy(void)
+    : _hcsz_min(Kernel::MemoryConfig::hcsz_min),
+      _hcsz_max(Kernel::MemoryConfig::hcsz_max),
+      _hcsz_inc_ratio(Kernel::MemoryConfig::hcsz_inc_ratio),
+      _hcsz_dec_ratio(Kernel::MemoryConfig::hcsz_dec_ratio) {}
+
+  forceinline size_t
+  MemoryPolicy::hcsz_min(void) const {
+    return _hcsz_min;
+  }
+  forceinline size_t
+  MemoryPolicy::hcsz_max(void) const {
+    return _hcsz_max;
+  }
+  forceinline unsigned int
+  MemoryPolicy::hcsz_inc_ratio(void) const {
+    return _hcsz_inc_ratio;
+  }
+  forceinline unsigned int
+  MemoryPolicy::hcsz_dec_ratio(void) const {
+    return _hcsz_dec_ratio;
+  }
+
+}
+
 namespace Gecode { namespace Kernel {
 
   /*
@@ -185,47 +325,14 @@ namespace Gecode { namespace Kernel {
     heap.n_hc = 0;
     heap.hc = NULL;
   }
-  forceinline
-  SharedMemory::~SharedMemory(void) {
-    while (heap.hc != NULL) {
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
-  }
 
-  forceinline HeapChunk*
-  SharedMemory::alloc(size_t s, size_t l) {
-    m().acquire();
-    while ((heap.hc != NULL) && (heap.hc->size < l)) {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      Gecode::heap.rfree(hc);
-    }
-    HeapChunk* hc;
-    if (heap.hc == NULL) {
-      assert(heap.n_hc == 0);
-      hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
-    } else {
-      heap.n_hc--;
-      hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-    }
-    m().release();
-    return hc;
+  forceinline const MemoryPolicy&
+  SharedMemory::policy(void) const {
+    return mp;
   }
   forceinline void
-  SharedMemory::free(HeapChunk* hc) {
-    m().acquire();
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
-    } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
-    }
-    m().release();
+  SharedMemory::policy(const MemoryPolicy& p) {
+    mp = p;
   }
 
 
@@ -299,13 +406,21 @@ namespace Gecode { namespace Kernel {
     return &cur_hc->area[0];
   }
 
+  forceinline size_t
+  MemoryManager::allocated(void) const {
+    return requested;
+  }
+
   forceinline void
   MemoryManager::alloc_fill(SharedMemory& sm, size_t sz, bool first) {
+    const MemoryPolicy& mp = sm.policy();
     // Adjust current heap chunk size
-    if (((requested > MemoryConfig::hcsz_inc_ratio*cur_hcsz) ||
-         (sz > cur_hcsz)) &&
-        (cur_hcsz < MemoryConfig::hcsz_max) &&
-        !first) {
+    if (cur_hcsz < mp.hcsz_min()) {
+      cur_hcsz = mp.hcsz_min();
+    } else if (((requested > mp.hcsz_inc_ratio()*cur_hcsz) ||
+                (sz > cur_hcsz)) &&
+               (cur_hcsz < mp.hcsz_max()) &&
+               !first) {
       cur_hcsz <<= 1;
     }
     // Increment the size that it caters for the initial overhead
@@ -314,6 +429,9 @@ namespace Gecode { namespace Kernel {
     // Round size to next multiple of current heap chunk size
     size_t allocate = ((sz > cur_hcsz) ?
                        (((size_t) (sz / cur_hcsz)) + 1) * cur_hcsz : cur_hcsz);
+    // Rounding must not exceed the maximal chunk size
+    if ((sz <= mp.hcsz_max()) && (allocate > mp.hcsz_max()))
+      allocate = mp.hcsz_max();
     // Request a chunk of preferably size allocate, but at least size sz
     HeapChunk* hc = sm.alloc(allocate,sz);
     start = ptr_cast<char*>(&hc->area[0]);
@@ -334,7 +452,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   MemoryManager::MemoryManager(SharedMemory& sm)
-    : cur_hcsz(MemoryConfig::hcsz_min), requested(0), slack(NULL) {
+    : cur_hcsz(sm.policy().hcsz_min()), requested(0), slack(NULL) {
     alloc_fill(sm,cur_hcsz,true);
     for (size_t i = MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
          i--; )
@@ -346,11 +464,28 @@ namespace Gecode { namespace Kernel {
                                size_t s_sub)
     : cur_hcsz(mm.cur_hcsz), requested(0), slack(NULL) {
     MemoryConfig::align(s_sub);
-    if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
-        (cur_hcsz > MemoryConfig::hcsz_min) &&
-        (s_sub*2 < cur_hcsz))
+    const MemoryPolicy& mp = sm.policy();
+    if (cur_hcsz < mp.hcsz_min())
+      cur_hcsz = mp.hcsz_min();
+    else if ((mm.requested < mp.hcsz_dec_ratio()*mm.cur_hcsz) &&
+             (cur_hcsz > mp.hcsz_min()) &&
+             (s_sub*2 < cur_hcsz))
       cur_hcsz >>= 1;
-    alloc_fill(sm,cur_hcsz+s_sub,true);
+    /*
+     * Request a single heap chunk that is likely to be large enough
+     * for the entire copy: the copy needs about as much memory as is
+     * used by the original space (including its memory area for
+     * subscriptions, which leaves some slack). The chunk does not
+     * exceed the maximal chunk size of the memory policy (unless the
+     * subscriptions need more), so that it can be cached when released;
+     * the rest of the copy is allocated on demand.
+     */
+    size_t used = mm.requested - mm.lsz;
+    size_t sz = std::max(cur_hcsz,used) + s_sub;
+    size_t overhead = sizeof(HeapChunk) - sizeof(double);
+    if (sz + overhead > mp.hcsz_max())
+      sz = std::max(mp.hcsz_max() - overhead, s_sub);
+    alloc_fill(sm,sz,true);
     // Skip the memory area at the beginning for subscriptions
     lsz   -= s_sub;
     start += s_sub;
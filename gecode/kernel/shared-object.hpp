@@ -86,6 +86,8 @@ namespace Gecode {
     SharedHandle::Object* object(void) const;
     /// Modify shared object
     void object(SharedHandle::Object* n);
+    /// Whether this handle is the only one referring to its object
+    bool unique(void) const;
   };
 
 
@@ -139,6 +141,10 @@ namespace Gecode {
   SharedHandle::operator bool(void) const {
     return o != nullptr;
   }
+  forceinline bool
+  SharedHandle::unique(void) const {
+    return (o != nullptr) && o->rc.unique();
+  }
   forceinline
   SharedHandle::~SharedHandle(void) {
     cancel();
@@ -2338,6 +2338,12 @@ namespace Gecode {
     /// Member function constraining according to decreasing cost
     GECODE_MINIMODEL_EXPORT
     virtual void constrain(const Space& best);
+    /// Return cost as objective value
+    GECODE_MINIMODEL_EXPORT
+    virtual bool objective(long long int& o) const;
+    /// Member function constraining objective to be less than \a o
+    GECODE_MINIMODEL_EXPORT
+    virtual void bound(long long int o);
     /// Return variable with current cost
     virtual IntVar cost(void) const = 0;
   };
@@ -2355,6 +2361,12 @@ namespace Gecode {
     /// Member function constraining according to increasing cost
     GECODE_MINIMODEL_EXPORT
     virtual void constrain(const Space& best);
+    /// Return negated cost as objective value
+    GECODE_MINIMODEL_EXPORT
+    virtual bool objective(long long int& o) const;
+    /// Member function constraining objective to be less than \a o
+    GECODE_MINIMODEL_EXPORT
+    virtual void bound(long long int o);
     /// Return variable with current cost
     virtual IntVar cost(void) const = 0;
   };
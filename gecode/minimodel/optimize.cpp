@@ -44,6 +44,20 @@ namespace Gecode {
     rel(*this, cost(), IRT_LE, best->cost().val());
   }
 
+  bool
+  IntMinimizeSpace::objective(long long int& o) const {
+    o = cost().val();
+    return true;
+  }
+
+  void
+  IntMinimizeSpace::bound(long long int o) {
+    if (o <= Int::Limits::min)
+      fail();
+    else if (o <= Int::Limits::max)
+      rel(*this, cost(), IRT_LE, static_cast<int>(o));
+  }
+
 
   void
   IntMaximizeSpace::constrain(const Space& _best) {
@@ -54,6 +68,20 @@ namespace Gecode {
     rel(*this, cost(), IRT_GR, best->cost().val());
   }
 
+  bool
+  IntMaximizeSpace::objective(long long int& o) const {
+    o = -static_cast<long long int>(cost().val());
+    return true;
+  }
+
+  void
+  IntMaximizeSpace::bound(long long int o) {
+    if (-o >= Int::Limits::max)
+      fail();
+    else if (-o >= Int::Limits::min)
+      rel(*this, cost(), IRT_GR, static_cast<int>(-o));
+  }
+
 
   void
   IntLexMinimizeSpace::constrain(const Space& _best) {
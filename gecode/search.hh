@@ -116,6 +116,20 @@ namespace Gecode { namespace Search {
     const unsigned int steal_limit = 3;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
+    /// Number of unsuccessful attempts to find work before an idle worker thread is parked
+    const unsigned int idle_spin = 64;
+    /// Depth for splitting work in deterministic parallel search
+    const unsigned int d_split = 8;
+    /// Maximal number of subproblems for deterministic parallel search
+    const unsigned int det_subproblems = 256;
+    /// Number of subproblems explored ahead in deterministic parallel search
+    const unsigned int det_window = 64;
+    /// Number of subproblems per thread for embarrassingly parallel search
+    const unsigned int subproblems = 30;
+    /// Default port for distributed search
+    const unsigned int port = 6566U;
+    /// Default address the master of distributed search listens on
+    const char* const address = "127.0.0.1";
 
     /// Default discrepancy limit for LDS
     const unsigned int d_l = 5;
@@ -124,9 +138,36 @@ namespace Gecode { namespace Search {
     const double base = 1.5;
     /// Size of a slice in a portfolio and scale factor for restarts(in number of failures)
     const unsigned int slice = 250;
+    /// Maximal number of slices per turn of an asset in an adaptive portfolio
+    const unsigned int pbs_weight = 8;
+    /// Number of turns without progress before an asset of an adaptive portfolio is respawned
+    const unsigned int pbs_stall = 4;
+
+    /// Number of depths for which failures are recorded by the statistics
+    const unsigned int fail_depth = 64;
+    /// Number of workers for which steals are recorded by the statistics
+    const unsigned int steal_worker = 64;
 
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
+    /// Maximal number of no-goods kept by a no-good store
+    const unsigned int nogoods_store = 4096;
+    /// Decay factor for the activity of no-goods in a no-good store
+    const double nogoods_decay = 0.95;
+
+    /// Default interval between checkpoints (in milliseconds)
+    const unsigned long int checkpoint = 5000UL;
+    /// Number of nodes explored between tests whether a checkpoint is due
+    const unsigned long int checkpoint_nodes = 256UL;
+
+    /// Initial ratio of relaxed variables for large neighborhood search
+    const double lns_ratio = 0.3;
+    /// Smallest ratio of relaxed variables for large neighborhood search
+    const double lns_ratio_min = 0.02;
+    /// Factor by which the ratio of relaxed variables is adapted
+    const double lns_adapt = 1.2;
+    /// Weight of exploration for bandit selection of neighborhoods
+    const double lns_explore = 0.5;
 
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
@@ -154,14 +195,81 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// Number of successful attempts to steal work (parallel search)
+    unsigned long int steal;
+    /// Number of attempts to steal work that found none (parallel search)
+    unsigned long int steal_fail;
+    /// Number of successful steals from a worker on another NUMA node
+    unsigned long int steal_remote;
+    /// Number of clones created for recomputation
+    unsigned long int clone;
+    /// Number of spaces recomputed
+    unsigned long int recompute;
+    /// Peak memory (in bytes) of clones stored for recomputation
+    size_t memory;
+    /// \name Time (in milliseconds) if search is instrumented
+    //@{
+    /// Time for propagation
+    double t_propagate;
+    /// Time for cloning
+    double t_clone;
+    /// Time for recomputation (including cloning and propagation during recomputation)
+    double t_recompute;
+    /// Time for finding and stealing work (parallel search)
+    double t_steal;
+    /// Time being idle while waiting for work (parallel search)
+    double t_idle;
+    //@}
+  protected:
+    /**
+     * \brief Histograms (NULL if not recorded)
+     *
+     * The first Config::fail_depth entries count failures per depth,
+     * the remaining Config::steal_worker entries count steals per
+     * worker.
+     */
+    unsigned long int* h;
+  public:
     /// Initialize
     Statistics(void);
+    /// Copy constructor
+    Statistics(const Statistics& s);
+    /// Assignment operator
+    Statistics& operator =(const Statistics& s);
     /// Reset
     void reset(void);
     /// Return sum with \a s
     Statistics operator +(const Statistics& s);
     /// Increment by statistics \a s
     Statistics& operator +=(const Statistics& s);
+    /// Record failure at depth \a d
+    void failure(unsigned long int d);
+    /// Record that work has been stolen from worker \a i
+    void stolen(unsigned int i);
+    /// \name Histograms (only recorded if search is instrumented)
+    //@{
+    /// Set whether histograms are recorded
+    void histograms(bool b);
+    /// Test whether histograms are recorded
+    bool histograms(void) const;
+    /**
+     * \brief Return number of failed nodes at depth \a d
+     *
+     * Failures at a depth of at least Config::fail_depth-1 are counted
+     * for depth Config::fail_depth-1.
+     */
+    unsigned long int fail_depth(unsigned int d) const;
+    /**
+     * \brief Return number of successful attempts to steal work from worker \a i
+     *
+     * Steals from workers with a number of at least
+     * Config::steal_worker-1 are counted for worker
+     * Config::steal_worker-1.
+     */
+    unsigned long int steal_worker(unsigned int i) const;
+    //@}
+    /// Destructor
+    ~Statistics(void);
   };
 
 }}
@@ -477,6 +585,15 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const = 0;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void) = 0;
+    /**
+     * \brief Return copy starting the sequence anew for thread \a i
+     *
+     * Random sequences use a different seed for each \a i. The default
+     * returns NULL, that is, the generator cannot be copied and
+     * cannot be used for independent restarts (see
+     * Options::independent).
+     */
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~Cutoff(void);
     //@}
@@ -531,6 +648,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -550,6 +669,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -577,6 +698,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -598,6 +721,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -616,6 +741,10 @@ namespace Gecode { namespace Search {
     unsigned long int step;
     /// Current value
     unsigned long int cur;
+    /// Seed
+    unsigned int s;
+    /// Maximum cutoff value
+    unsigned long int max;
   public:
     /// Constructor
     CutoffRandom(unsigned int seed,
@@ -625,6 +754,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
   };
 
   /**
@@ -639,6 +770,8 @@ namespace Gecode { namespace Search {
     Cutoff* c2;
     /// How many number to take from the first
     unsigned long int n;
+    /// How many numbers to take from the first initially
+    unsigned long int m;
   public:
     /// Constructor
     CutoffAppend(Cutoff* c1, unsigned long int n, Cutoff* c2);
@@ -646,6 +779,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~CutoffAppend(void);
   };
@@ -667,6 +802,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~CutoffMerge(void);
   };
@@ -692,6 +829,8 @@ namespace Gecode { namespace Search {
     virtual unsigned long int operator ()(void) const;
     /// Increment and return the next cutoff value
     virtual unsigned long int operator ++(void);
+    /// Return copy starting the sequence anew for thread \a i
+    virtual Cutoff* copy(unsigned int i) const;
     /// Destructor
     virtual ~CutoffRepeat(void);
   };
@@ -703,6 +842,9 @@ namespace Gecode { namespace Search {
 namespace Gecode { namespace Search {
 
     class Stop;
+    class NoGoodStore;
+    class Neighborhoods;
+    class Checkpoint;
 
     /**
      * \brief %Search engine options
@@ -728,7 +870,9 @@ namespace Gecode { namespace Search {
      *
      * All recomputation performed is based on batch recomputation: batch
      * recomputation performs propagation only once for an entire path
-     * used in recomputation.
+     * used in recomputation. Adaptive recomputation and branch-and-bound
+     * search might still propagate intermediate spaces on the path, this
+     * can be avoided by strict batch recomputation (see \a batch).
      *
      * The number of threads to be used is controlled by a double \f$n\f$
      * (assume that \f$m\f$ is the number of processing units available). If
@@ -747,22 +891,128 @@ namespace Gecode { namespace Search {
       bool clone;
       /// Number of threads to use
       double threads;
+      /**
+       * \brief Whether parallel search is NUMA-aware
+       *
+       * Worker threads are distributed over the NUMA nodes and bound to
+       * their processing units, and idle workers first try to steal
+       * work from workers on the same node.
+       */
+      bool numa;
+      /**
+       * \brief Number of NUMA nodes for NUMA-aware parallel search
+       *
+       * If zero, the NUMA nodes of the machine are used. Otherwise,
+       * workers are distributed over the given number of nodes, where
+       * workers on nodes not present on the machine are not bound.
+       */
+      unsigned int numa_nodes;
+      /**
+       * \brief Whether parallel search is deterministic
+       *
+       * The search tree is split level by level into subproblems down
+       * to depth \a d_split (but into at most Config::det_subproblems
+       * subproblems), the subproblems are explored in parallel, and
+       * their solutions are reported in depth-first order. Solutions
+       * and statistics are then independent of the number of threads,
+       * provided that branching does not depend on information shared
+       * between spaces (such as AFC or action). Stop objects are
+       * checked against the statistics of each subproblem, and tracers
+       * are not supported (search then is not deterministic).
+       */
+      bool deterministic;
+      /// Depth for splitting work in deterministic parallel search
+      unsigned int d_split;
+      /// Number of subproblems for embarrassingly parallel search (0 for Config::subproblems per thread)
+      unsigned int subproblems;
+      /// Port on which the master of distributed search listens
+      unsigned int port;
+      /**
+       * \brief Address on which the master of distributed search listens
+       *
+       * By default, only workers on the same host can connect. As
+       * workers are not authenticated, the master should only listen
+       * on other addresses (for example, \c "0.0.0.0" for all IPv4
+       * addresses) in a trusted network.
+       */
+      const char* address;
       /// Create a clone after every \a c_d commits (commit distance)
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /**
+       * \brief Whether to use strict batch recomputation
+       *
+       * All commits on the path from the last clone to the node to be
+       * recomputed are replayed in a single pass and propagation is
+       * performed only once for the recomputed node: no intermediate
+       * clones are created by adaptive recomputation (\a a_d is
+       * ignored) and branch-and-bound search constrains only the
+       * recomputed space rather than the clone on the path.
+       */
+      bool batch;
+      /**
+       * \brief Memory budget (in bytes) for clones stored for recomputation
+       *
+       * If the budget is not zero, sequential depth-first and
+       * branch-and-bound search ignore the commit distance \a c_d.
+       * Instead, clones are placed such that the time for cloning and
+       * the time for recomputation are balanced, as estimated from the
+       * measured size of clones and the measured time for cloning
+       * and for propagation. Clones are only created if they fit into
+       * the budget, the path is recomputed from fewer clones otherwise.
+       */
+      size_t memory;
+      /**
+       * \brief Whether parallel branch-and-bound search uses objective values
+       *
+       * If spaces provide an objective value (see Space::objective),
+       * only the objective value of a better solution is shared among
+       * the workers, which then constrain by Space::bound instead of
+       * Space::constrain. This must only be used if constraining by
+       * bound is equivalent to Space::constrain, that is, if
+       * Space::constrain is not overridden to post further constraints.
+       */
+      bool objective;
+      /**
+       * \brief Whether search is instrumented
+       *
+       * If instrumented, engines measure the time spent for
+       * propagation, cloning, recomputation, stealing work, and being
+       * idle (see Statistics). As time is measured for every node
+       * explored, instrumentation slows down search noticeably.
+       */
+      bool instrument;
       /// Discrepancy limit (for LDS)
       unsigned int d_l;
       /// Number of assets (engines) in a portfolio
       unsigned int assets;
       /// Size of a slice in a portfolio (in number of failures)
       unsigned int slice;
+      /**
+       * \brief Whether a sequential portfolio adapts to its assets
+       *
+       * Assets that make progress (that is, find solutions) get more
+       * slices per turn, assets without progress get fewer. For best
+       * solution search, an asset that has not made progress for
+       * Config::pbs_stall turns while another asset has is respawned
+       * with a new asset number (see MetaInfo::asset).
+       */
+      bool adaptive;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Store keeping no-goods across restarts (possibly shared)
+      NoGoodStore* nogoods_store;
+      /// Whether threads of restart-based search restart independently
+      bool independent;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
       Cutoff* cutoff;
+      /// Neighborhoods for large neighborhood search
+      Neighborhoods* neighborhoods;
+      /// Checkpoint for saving and resuming the search frontier
+      Checkpoint* checkpoint;
       /// Tracer object for tracing search
       SearchTracer* tracer;
       /// Default options
@@ -889,6 +1139,307 @@ namespace Gecode { namespace Search {
 
 #include <gecode/search/stop.hpp>
 
+namespace Gecode { namespace Search {
+
+  class StoredNoGoods;
+
+  /**
+   * \brief Store for no-goods that persists across restarts
+   *
+   * Restart-based search using the store (see Options::nogoods_store)
+   * records the no-goods of every restart (limited by
+   * Options::nogoods_limit) in the store and then posts all
+   * no-goods it has not yet posted as a single propagator. The store
+   * can be shared by all engines that search from the same root with
+   * the same branchers, for example by all assets of a portfolio.
+   * As the no-goods rule out the parts of the search tree already
+   * explored, an engine using the store does not find solutions
+   * again that have been found by engines using the store before.
+   *
+   * Restart-based branch-and-bound search only posts the no-goods
+   * from the store but does not record its own no-goods: they
+   * depend on the bound at the time they have been found.
+   *
+   * The activity of a no-good is increased whenever it is recorded
+   * again, and decays at every restart. Prunings by a no-good
+   * increase its activity when the store exceeds its capacity: then
+   * the least active no-goods are dropped (also from spaces they
+   * have been posted to).
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT NoGoodStore {
+  protected:
+    /// Mutex for access by several engines
+    mutable Support::Mutex m;
+    /// The stored no-goods
+    StoredNoGoods* s;
+  public:
+    /// Initialize store with capacity \a c and activity decay \a d
+    NoGoodStore(unsigned int c=Config::nogoods_store,
+                double d=Config::nogoods_decay);
+    /// Record no-goods \a ng
+    void record(const NoGoods& ng);
+    /**
+     * \brief Post no-goods not yet posted to \a home
+     *
+     * Only no-goods recorded after stamp \a t are posted, \a t is
+     * updated to the current stamp. Returns the number of no-goods
+     * posted.
+     */
+    unsigned long int post(Space& home, unsigned long int& t) const;
+    /// Return number of stored no-goods
+    unsigned int size(void) const;
+    /// Destructor
+    ~NoGoodStore(void);
+  };
+
+  /**
+   * \brief Checkpoint for saving and resuming search
+   *
+   * A sequential depth-first (Gecode::DFS) or branch-and-bound
+   * (Gecode::BAB) engine using a checkpoint (see Options::checkpoint)
+   * writes the open part of its search tree to the file of the
+   * checkpoint whenever the checkpoint interval has elapsed, when it
+   * is stopped, and when it has explored its entire search tree.
+   * A checkpoint stores the archived choices of the path to the
+   * node currently explored (together with the alternatives taken)
+   * and, for branch-and-bound, the path to the best solution found.
+   * The cost of writing a checkpoint is thus proportional to the
+   * depth of the search tree, the elapsed time is only tested every
+   * Config::checkpoint_nodes nodes.
+   *
+   * If the checkpoint is created for resuming and its file exists,
+   * the engine restarts from the stored frontier by replaying the
+   * archived choices on its root space. A branch-and-bound engine
+   * then first returns the best solution stored in the checkpoint.
+   * Solutions found after the last checkpoint has been written are
+   * found again.
+   *
+   * Resuming requires the same model and branchers as the search
+   * that wrote the checkpoint. If the file does not contain a
+   * complete checkpoint, the engine throws Search::CheckpointFailure.
+   * Checkpoints are ignored by parallel and meta search engines.
+   *
+   * The file is replaced atomically: a checkpoint is written to a
+   * temporary file which is then renamed.
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT Checkpoint : public HeapAllocated {
+  protected:
+    /// Name of the checkpoint file
+    std::string fn;
+    /// Interval between checkpoints in milliseconds
+    unsigned long int i;
+    /// Whether to resume from the checkpoint file
+    bool r;
+    /// Timer for the time elapsed since the last checkpoint
+    mutable Support::Timer t;
+    /// Number of checkpoints written
+    unsigned long int n;
+  public:
+    /**
+     * \brief Initialize checkpoint
+     *
+     * The checkpoint is written to the file \a fn every \a i
+     * milliseconds. If \a r is true, search resumes from \a fn
+     * (if the file exists).
+     */
+    Checkpoint(const std::string& fn,
+               unsigned long int i=Config::checkpoint, bool r=true);
+    /// Return name of checkpoint file
+    const std::string& file(void) const;
+    /// Return interval between checkpoints in milliseconds
+    unsigned long int interval(void) const;
+    /// Set interval between checkpoints to \a i milliseconds
+    void interval(unsigned long int i);
+    /// Whether search resumes from the checkpoint file
+    bool resume(void) const;
+    /// Return number of checkpoints written
+    unsigned long int written(void) const;
+    /// Test whether a checkpoint is due
+    bool due(void) const;
+    /// Write checkpoint \a a to the file and restart interval
+    void write(const Archive& a);
+    /// Read checkpoint into \a a, return false if there is none
+    bool read(Archive& a) const;
+    /// Destructor
+    virtual ~Checkpoint(void);
+  };
+
+}}
+
+#include <gecode/search/checkpoint.hpp>
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Neighborhood for large neighborhood search
+   *
+   * A neighborhood relaxes a solution: all variables but the relaxed
+   * ones are constrained to take their values from the solution.
+   * Neighborhoods do not maintain any state and can be used by several
+   * threads at the same time.
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT Neighborhood : public HeapAllocated {
+  public:
+    /// Default constructor
+    Neighborhood(void);
+    /**
+     * \brief Relax solution \a s in space \a home
+     *
+     * Approximately a fraction \a r of the variables is relaxed, all
+     * other variables take their values from \a s. Random numbers
+     * are taken from \a rnd. Returns whether no variable has been
+     * constrained, that is, whether exploring \a home is complete.
+     */
+    virtual bool relax(Space& home, const Space& s, double r,
+                       Rnd rnd) const = 0;
+    /// Destructor
+    virtual ~Neighborhood(void);
+  };
+
+  /**
+   * \brief Neighborhoods for large neighborhood search
+   *
+   * Selects the neighborhood used for relaxing the last solution and
+   * adapts the ratio of relaxed variables for each neighborhood: the
+   * ratio increases when a neighborhood has been explored without
+   * finding a better solution and decreases when exploration has
+   * been stopped by the fail limit.
+   *
+   * The neighborhoods are deleted together with the last object that
+   * refers to them (including copies).
+   *
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT Neighborhoods : public HeapAllocated {
+  protected:
+    class Shared;
+    /// The shared neighborhoods
+    Shared* sh;
+    /// The ratio of relaxed variables for each neighborhood
+    double* r;
+    /// The initial ratio of relaxed variables
+    double r0;
+    /// The seed for the random number generator
+    unsigned int s;
+    /// The random number generator
+    Rnd rnd;
+    /// Initialize for neighborhoods \a n with ratio \a r0 and seed \a s
+    Neighborhoods(const std::vector<Neighborhood*>& n,
+                  double r0, unsigned int s);
+    /// Initialize as copy of \a n with seed incremented by \a i
+    Neighborhoods(const Neighborhoods& n, unsigned int i);
+    /// Reward neighborhood \a i with \a v (between 0 and 1)
+    virtual void reward(unsigned int i, double v);
+  public:
+    /// Return number of neighborhoods
+    unsigned int size(void) const;
+    /// Return ratio of relaxed variables for neighborhood \a i
+    double ratio(unsigned int i) const;
+    /// Return index of neighborhood to be used next
+    virtual unsigned int select(void) = 0;
+    /**
+     * \brief Relax solution \a s in \a home by neighborhood \a i
+     *
+     * Returns whether exploring \a home is complete.
+     */
+    bool relax(unsigned int i, Space& home, const Space& s);
+    /// Neighborhood \a i has led to a solution with improvement \a v
+    void improved(unsigned int i, double v);
+    /// Neighborhood \a i has been explored without solution
+    void exhausted(unsigned int i);
+    /// Exploring neighborhood \a i has been stopped by the fail limit
+    void limited(unsigned int i);
+    /**
+     * \brief Return copy starting anew for thread \a i
+     *
+     * The copy shares the neighborhoods but uses a different seed.
+     */
+    virtual Neighborhoods* copy(unsigned int i) const = 0;
+    /// Destructor
+    virtual ~Neighborhoods(void);
+    /// \name Predefined neighborhood selections
+    //@{
+    /**
+     * \brief Select uniformly at random from neighborhoods \a n
+     *
+     * The initial ratio of relaxed variables is \a r and \a s is
+     * the seed for the random number generator.
+     */
+    static Neighborhoods*
+    uniform(const std::vector<Neighborhood*>& n,
+            double r=Config::lns_ratio, unsigned int s=0U);
+    /**
+     * \brief Select by a multi-armed bandit from neighborhoods \a n
+     *
+     * The neighborhood with the largest upper confidence bound of
+     * its average reward is selected, where the reward is the relative
+     * improvement of the objective value (see Space::objective) and
+     * \a e weighs the exploration of rarely used neighborhoods. The
+     * initial ratio of relaxed variables is \a r and \a s is the seed
+     * for the random number generator.
+     */
+    static Neighborhoods*
+    bandit(const std::vector<Neighborhood*>& n,
+           double r=Config::lns_ratio, double e=Config::lns_explore,
+           unsigned int s=0U);
+    //@}
+  };
+
+  /**
+   * \brief Uniform selection of neighborhoods
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT NeighborhoodsUniform : public Neighborhoods {
+  public:
+    /// Constructor
+    NeighborhoodsUniform(const std::vector<Neighborhood*>& n,
+                         double r, unsigned int s);
+    /// Copy constructor for thread \a i
+    NeighborhoodsUniform(const NeighborhoodsUniform& n, unsigned int i);
+    /// Return index of neighborhood to be used next
+    virtual unsigned int select(void);
+    /// Return copy starting anew for thread \a i
+    virtual Neighborhoods* copy(unsigned int i) const;
+  };
+
+  /**
+   * \brief Selection of neighborhoods by a multi-armed bandit
+   * \ingroup TaskModelSearch
+   */
+  class GECODE_SEARCH_EXPORT NeighborhoodsBandit : public Neighborhoods {
+  protected:
+    /// Weight of exploration
+    double e;
+    /// How often each neighborhood has been used
+    unsigned long int* n;
+    /// Average reward of each neighborhood
+    double* v;
+    /// How often neighborhoods have been used in total
+    unsigned long int t;
+    /// Reward neighborhood \a i with \a v (between 0 and 1)
+    virtual void reward(unsigned int i, double v);
+  public:
+    /// Constructor
+    NeighborhoodsBandit(const std::vector<Neighborhood*>& n,
+                        double r, double e, unsigned int s);
+    /// Copy constructor for thread \a i
+    NeighborhoodsBandit(const NeighborhoodsBandit& n, unsigned int i);
+    /// Return index of neighborhood to be used next
+    virtual unsigned int select(void);
+    /// Return copy starting anew for thread \a i
+    virtual Neighborhoods* copy(unsigned int i) const;
+    /// Destructor
+    virtual ~NeighborhoodsBandit(void);
+  };
+
+}}
+
 namespace Gecode { namespace Search {
 
   /**
@@ -908,6 +1459,10 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods (the no-goods are empty)
     virtual NoGoods& nogoods(void);
+    /// Return number of assets (zero if the engine is no portfolio)
+    virtual unsigned int assets(void) const;
+    /// Return statistics of asset \a a (empty statistics)
+    virtual Statistics asset(unsigned int a) const;
     /// Destructor
     virtual ~Engine(void);
   };
@@ -1101,6 +1656,12 @@ namespace Gecode {
 
   /**
    * \brief Limited discrepancy search engine
+   *
+   * With more than one thread, the root is decomposed into
+   * subproblems and the probes for a discrepancy are distributed
+   * among the threads. All solutions with fewer discrepancies are
+   * found before any solution with more discrepancies.
+   *
    * \ingroup TaskModelSearch
    */
   template<class T>
@@ -1127,6 +1688,91 @@ namespace Gecode {
 
 #include <gecode/search/lds.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Embarrassingly parallel search engine
+   *
+   * The root is decomposed into Search::Options::subproblems
+   * subproblems by enumerating consistent assignments to a prefix of
+   * the branching. The subproblems are processed from a shared queue
+   * by sequential engines of type \a E (either DFS or BAB) on
+   * Search::Options::threads threads. For best solution search, the
+   * best solution is shared between all subproblems. With a single
+   * thread or a tracer, the engine falls back to \a E.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class EPS : public Search::Base<T> {
+  public:
+    /// Initialize engine for space \a s and options \a o
+    EPS(T* s, const Search::Options& o=Search::Options::def);
+    /// Whether engine does best solution search
+    static const bool best = E<T>::best;
+  };
+
+  /// Perform embarrassingly parallel search for subclass \a T of space \a s with options \a o
+  template<class T, template<class> class E>
+  T* eps(T* s, const Search::Options& o=Search::Options::def);
+
+  /// Return an embarrassingly parallel search engine builder
+  template<class T, template<class> class E>
+  SEB eps(const Search::Options& o=Search::Options::def);
+
+}
+
+#include <gecode/search/eps.hpp>
+
+namespace Gecode {
+
+  /**
+   * \brief Master engine for distributed search
+   *
+   * The root is decomposed into Search::Options::subproblems
+   * subproblems, each represented by the path of archived choices
+   * (see Choice::archive) leading to it. The master listens on port
+   * Search::Options::port at Search::Options::address (by default,
+   * the loopback address) for worker processes (see distworker), ships
+   * the paths to them, and reconstructs the solutions from the paths
+   * the workers report. All workers must start from the same root
+   * as the master (for example, by creating the same model with the
+   * same options), and all branchers must support archiving.
+   *
+   * For best solution search with \a E being BAB, every better
+   * solution is broadcast to all workers as a bound. If a worker
+   * disconnects, its subproblem is given to another worker. The
+   * stop object is checked by the master, running subproblems are
+   * not interrupted.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class Dist : public Search::Base<T> {
+  public:
+    /// Initialize engine for space \a s and options \a o
+    Dist(T* s, const Search::Options& o=Search::Options::def);
+    /// Whether engine does best solution search
+    static const bool best = E<T>::best;
+  };
+
+  /**
+   * \brief Run worker for distributed search
+   *
+   * The worker explores the subproblems of space \a s it receives
+   * from the master at \a host and \a port with sequential engines
+   * until the master quits.
+   * The space \a s is deleted by the worker.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E>
+  void distworker(T* s, const std::string& host, unsigned int port);
+
+}
+
+#include <gecode/search/dist.hpp>
+
 namespace Gecode {
 
   /**
@@ -1145,6 +1791,15 @@ namespace Gecode {
    * space. For more details, consult "Modeling and Programming
    * with Gecode".
    *
+   * If Search::Options::independent is set and more than one thread
+   * is requested, each thread performs its own restart-based search
+   * with a copy of the cutoff sequence (see Search::Cutoff::copy) as
+   * an asset of a portfolio: the slave spaces are passed the number
+   * of the asset (for example, for seeding random branchings) and
+   * better solutions found by one thread constrain the others. If the
+   * cutoff cannot be copied, the exception Search::UncopiableCutoff
+   * is thrown.
+   *
    * \ingroup TaskModelSearch
    */
   template<class T, template<class> class E = DFS>
@@ -1251,6 +1906,10 @@ namespace Gecode {
     /// Initialize with engine builders \a seb0, \a seb1, \a seb2, and \a seb3
     PBS(T* s, SEB seb0, SEB seb1, SEB seb2, SEB seb3,
         const Search::Options& o=Search::Options::def);
+    /// Return number of assets
+    unsigned int assets(void) const;
+    /// Return statistics of asset \a a
+    Search::Statistics asset(unsigned int a) const;
     /// Whether engine does best solution search
     static const bool best = E<T>::best;
   };
@@ -1283,6 +1942,61 @@ namespace Gecode {
 
 #include <gecode/search/pbs.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Meta-engine performing large neighborhood search
+   *
+   * After an initial solution has been found, the engine repeatedly
+   * relaxes the last solution by one of the neighborhoods supplied
+   * in the options \a o (see Search::Neighborhoods) and searches with
+   * engine \a E for a better solution in the relaxed space. The fail
+   * limit for exploring a neighborhood is taken from the cutoff
+   * sequence in \a o (a constant limit of Search::Config::slice
+   * failures if there is none).
+   *
+   * Search is complete if a neighborhood that does not constrain any
+   * variable has been explored: then the last solution is optimal.
+   *
+   * With more than one thread, each thread explores its own
+   * neighborhoods with a copy of the neighborhoods and cutoff sequence
+   * and better solutions found by one thread are shared with the
+   * others.
+   *
+   * The class \a T must implement a constrain function (see
+   * Space::constrain) and can implement an objective function (see
+   * Space::objective) that is used for rewarding neighborhoods.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class LNS : public Search::Base<T> {
+    using Search::Base<T>::e;
+  public:
+    /// Initialize engine for space \a s and options \a o
+    LNS(T* s, const Search::Options& o);
+    /// Whether engine does best solution search
+    static const bool best = true;
+  };
+
+  /**
+   * \brief Perform large neighborhood search
+   *
+   * For more details, see the class LNS.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E>
+  T* lns(T* s, const Search::Options& o);
+
+  /// Return a large neighborhood search engine builder
+  template<class T, template<class> class E>
+  SEB lns(const Search::Options& o);
+
+}
+
+#include <gecode/search/lns.hpp>
+
 #endif
 
 // STATISTICS: search-other
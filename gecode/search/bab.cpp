@@ -37,6 +37,7 @@
 #include <gecode/search/seq/bab.hh>
 #ifdef GECODE_HAS_THREADS
 #include <gecode/search/par/bab.hh>
+#include <gecode/search/par/det.hh>
 #endif
 
 namespace Gecode { namespace Search {
@@ -53,6 +54,8 @@ namespace Gecode { namespace Search {
     } else {
       if (to.tracer)
         return new Par::BAB<EdgeTraceRecorder>(s,to);
+      else if (to.deterministic)
+        return new Par::Det(s,to,true);
       else
         return new Par::BAB<NoTraceRecorder>(s,to);
     }
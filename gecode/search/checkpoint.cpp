@@ -0,0 +1,95 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search.hh>
+
+#include <cstdio>
+#include <fstream>
+
+namespace Gecode { namespace Search {
+
+  namespace {
+    /// Magic number at the start of a checkpoint file
+    const unsigned int magic = 0x4743504bU;
+  }
+
+  void
+  Checkpoint::write(const Archive& a) {
+    std::string tmp = fn + ".tmp";
+    {
+      std::ofstream os(tmp.c_str(), std::ios::out | std::ios::binary |
+                       std::ios::trunc);
+      unsigned int h[2] = {magic, static_cast<unsigned int>(a.size())};
+      os.write(reinterpret_cast<const char*>(&h[0]), sizeof(h));
+      for (int j=0; j<a.size(); j++) {
+        unsigned int w = a[j];
+        os.write(reinterpret_cast<const char*>(&w), sizeof(w));
+      }
+      os.close();
+      if (os.fail())
+        throw CheckpointFailure("Search::Checkpoint::write");
+    }
+    // Replace the previous checkpoint only after the new one is complete
+    if (std::rename(tmp.c_str(), fn.c_str()) != 0) {
+      (void) std::remove(fn.c_str());
+      if (std::rename(tmp.c_str(), fn.c_str()) != 0)
+        throw CheckpointFailure("Search::Checkpoint::write");
+    }
+    n++;
+    t.start();
+  }
+
+  bool
+  Checkpoint::read(Archive& a) const {
+    std::ifstream is(fn.c_str(), std::ios::in | std::ios::binary);
+    if (!is.is_open())
+      return false;
+    unsigned int h[2];
+    is.read(reinterpret_cast<char*>(&h[0]), sizeof(h));
+    if (!is || (h[0] != magic))
+      throw CheckpointFailure("Search::Checkpoint::read");
+    for (unsigned int j=0; j<h[1]; j++) {
+      unsigned int w;
+      if (!is.read(reinterpret_cast<char*>(&w), sizeof(w)))
+        throw CheckpointFailure("Search::Checkpoint::read");
+      a << w;
+    }
+    return true;
+  }
+
+  Checkpoint::~Checkpoint(void) {}
+
+}}
+
+// STATISTICS: search-other
@@ -0,0 +1,76 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Search {
+
+  forceinline
+  Checkpoint::Checkpoint(const std::string& fn0, unsigned long int i0,
+                         bool r0)
+    : fn(fn0), i(i0), r(r0), n(0UL) {
+    t.start();
+  }
+
+  forceinline const std::string&
+  Checkpoint::file(void) const {
+    return fn;
+  }
+
+  forceinline unsigned long int
+  Checkpoint::interval(void) const {
+    return i;
+  }
+
+  forceinline void
+  Checkpoint::interval(unsigned long int i0) {
+    i=i0;
+  }
+
+  forceinline bool
+  Checkpoint::resume(void) const {
+    return r;
+  }
+
+  forceinline unsigned long int
+  Checkpoint::written(void) const {
+    return n;
+  }
+
+  forceinline bool
+  Checkpoint::due(void) const {
+    return t.stop() >= static_cast<double>(i);
+  }
+
+}}
+
+// STATISTICS: search-other
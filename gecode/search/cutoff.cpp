@@ -40,6 +40,12 @@
 
 namespace Gecode { namespace Search {
 
+  Cutoff*
+  Cutoff::copy(unsigned int) const {
+    return NULL;
+  }
+
+
   unsigned long int
   CutoffConstant::operator ()(void) const {
     return c;
@@ -49,6 +55,11 @@ namespace Gecode { namespace Search {
     return c;
   }
 
+  Cutoff*
+  CutoffConstant::copy(unsigned int) const {
+    return new CutoffConstant(c);
+  }
+
 
   unsigned long int
   CutoffLinear::operator ()(void) const {
@@ -60,6 +71,11 @@ namespace Gecode { namespace Search {
     return n;
   }
 
+  Cutoff*
+  CutoffLinear::copy(unsigned int) const {
+    return new CutoffLinear(scale);
+  }
+
 
   unsigned long int
   CutoffLuby::start[CutoffLuby::n_start] = {
@@ -75,6 +91,11 @@ namespace Gecode { namespace Search {
     return scale*luby(i++);
   }
 
+  Cutoff*
+  CutoffLuby::copy(unsigned int) const {
+    return new CutoffLuby(scale);
+  }
+
 
   unsigned long int
   CutoffGeometric::operator ()(void) const {
@@ -86,6 +107,11 @@ namespace Gecode { namespace Search {
     return static_cast<unsigned long int>(scale * n);
   }
 
+  Cutoff*
+  CutoffGeometric::copy(unsigned int) const {
+    return new CutoffGeometric(static_cast<unsigned long int>(scale),base);
+  }
+
 
   unsigned long int
   CutoffRandom::operator ++(void) {
@@ -97,6 +123,11 @@ namespace Gecode { namespace Search {
     return cur;
   }
 
+  Cutoff*
+  CutoffRandom::copy(unsigned int i) const {
+    return new CutoffRandom(s+i,min,max,n);
+  }
+
 
   unsigned long int
   CutoffAppend::operator ()(void) const {
@@ -116,6 +147,17 @@ namespace Gecode { namespace Search {
     }
   }
 
+  Cutoff*
+  CutoffAppend::copy(unsigned int i) const {
+    Cutoff* d1 = c1->copy(i);
+    Cutoff* d2 = c2->copy(i);
+    if ((d1 == NULL) || (d2 == NULL)) {
+      delete d1; delete d2;
+      return NULL;
+    }
+    return new CutoffAppend(d1,m,d2);
+  }
+
 
   unsigned long int
   CutoffMerge::operator ()(void) const {
@@ -128,6 +170,17 @@ namespace Gecode { namespace Search {
     return (*c1)();
   }
 
+  Cutoff*
+  CutoffMerge::copy(unsigned int i) const {
+    Cutoff* d1 = c1->copy(i);
+    Cutoff* d2 = c2->copy(i);
+    if ((d1 == NULL) || (d2 == NULL)) {
+      delete d1; delete d2;
+      return NULL;
+    }
+    return new CutoffMerge(d1,d2);
+  }
+
 
   unsigned long int
   CutoffRepeat::operator ()(void) const {
@@ -143,6 +196,13 @@ namespace Gecode { namespace Search {
     return cutoff;
   }
 
+  Cutoff*
+  CutoffRepeat::copy(unsigned int i) const {
+    if (Cutoff* d = c->copy(i))
+      return new CutoffRepeat(d,n);
+    return NULL;
+  }
+
 
   Cutoff*
   Cutoff::constant(unsigned long int scale) {
@@ -91,14 +91,15 @@ namespace Gecode { namespace Search {
                              unsigned long int n0)
       : rnd(seed), min(min0), n(n0 == 0 ? (max0-min+1U) : n0),
         step(std::max(1UL,
-                      static_cast<unsigned long int>((max0-min0+1U)/n))) {
+                      static_cast<unsigned long int>((max0-min0+1U)/n))),
+        s(seed), max(max0) {
     cur = ++(*this);
   }
 
 
   forceinline
   CutoffAppend::CutoffAppend(Cutoff* d1, unsigned long int n0, Cutoff* d2)
-    : c1(d1), c2(d2), n(n0) {}
+    : c1(d1), c2(d2), n(n0), m(n0) {}
   forceinline
   CutoffAppend::~CutoffAppend(void) {
     delete c1; delete c2;
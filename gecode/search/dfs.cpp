@@ -37,6 +37,7 @@
 #include <gecode/search/seq/dfs.hh>
 #ifdef GECODE_HAS_THREADS
 #include <gecode/search/par/dfs.hh>
+#include <gecode/search/par/det.hh>
 #endif
 
 namespace Gecode { namespace Search {
@@ -53,6 +54,8 @@ namespace Gecode { namespace Search {
     } else {
       if (to.tracer)
         return new Par::DFS<EdgeTraceRecorder>(s,to);
+      else if (to.deterministic)
+        return new Par::Det(s,to,false);
       else
         return new Par::DFS<NoTraceRecorder>(s,to);
     }
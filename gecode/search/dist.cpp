@@ -0,0 +1,713 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/seq/dfs.hh>
+#include <gecode/search/seq/bab.hh>
+
+#ifdef GECODE_HAS_UNISTD_H
+
+#include <vector>
+#include <deque>
+#include <cstring>
+#include <cstdio>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+
+namespace Gecode { namespace Search { namespace Dist {
+
+  /*
+   * Messages are sequences of 32 bit words in network byte order: the
+   * number of words that follow, the message type, and the contents.
+   * Paths to nodes are archives containing for each edge the
+   * alternative, the size of the archived choice, and the choice.
+   */
+
+  /// Message types
+  enum Message {
+    M_JOB,      ///< Master sends path to subproblem
+    M_BOUND,    ///< Master sends path to better solution
+    M_QUIT,     ///< Master quits
+    W_DONE,     ///< Worker is done with subproblem (with statistics)
+    W_SOLUTION  ///< Worker sends path to solution
+  };
+
+#ifdef MSG_NOSIGNAL
+  const int send_flags = MSG_NOSIGNAL;
+#else
+  const int send_flags = 0;
+#endif
+
+  /// Send message of type \a t with contents \a a to \a fd
+  bool
+  send(int fd, Message t, const Archive& a) {
+    std::vector<uint32_t> b(static_cast<size_t>(a.size())+2);
+    b[0] = htonl(static_cast<uint32_t>(a.size()+1));
+    b[1] = htonl(static_cast<uint32_t>(t));
+    for (int i=0; i<a.size(); i++)
+      b[static_cast<size_t>(i)+2] = htonl(static_cast<uint32_t>(a[i]));
+    const char* p = reinterpret_cast<const char*>(b.data());
+    size_t n = b.size() * sizeof(uint32_t);
+    while (n > 0) {
+      ssize_t k = ::send(fd,p,n,send_flags);
+      if (k <= 0)
+        return false;
+      p += k; n -= static_cast<size_t>(k);
+    }
+    return true;
+  }
+
+  /// Read \a n bytes from \a fd into \a p
+  bool
+  read(int fd, char* p, size_t n) {
+    while (n > 0) {
+      ssize_t k = ::recv(fd,p,n,0);
+      if (k <= 0)
+        return false;
+      p += k; n -= static_cast<size_t>(k);
+    }
+    return true;
+  }
+
+  /// Receive message of type \a t with contents \a a from \a fd
+  bool
+  receive(int fd, Message& t, Archive& a) {
+    uint32_t n;
+    if (!read(fd,reinterpret_cast<char*>(&n),sizeof(n)))
+      return false;
+    n = ntohl(n);
+    if (n == 0)
+      return false;
+    std::vector<uint32_t> b(n);
+    if (!read(fd,reinterpret_cast<char*>(b.data()),n*sizeof(uint32_t)))
+      return false;
+    t = static_cast<Message>(ntohl(b[0]));
+    for (uint32_t i=1; i<n; i++)
+      a << static_cast<unsigned int>(ntohl(b[i]));
+    return true;
+  }
+
+  /// Test whether a message can be read from \a fd without blocking
+  bool
+  readable(int fd) {
+    fd_set fds;
+    FD_ZERO(&fds); FD_SET(fd,&fds);
+    struct timeval tv;
+    tv.tv_sec = 0; tv.tv_usec = 0;
+    return select(fd+1,&fds,NULL,NULL,&tv) > 0;
+  }
+
+  /// Return path \a p extended by alternative \a a of archived choice \a c
+  Archive
+  extend(const Archive& p, unsigned int a, const Archive& c) {
+    Archive e(p);
+    e << a << static_cast<unsigned int>(c.size());
+    for (int i=0; i<c.size(); i++)
+      e << c[i];
+    return e;
+  }
+
+  /// Replay path \a p on space \a s, return NULL if it fails
+  Space*
+  replay(Space* s, const Archive& p, Statistics& stat) {
+    int i = 0;
+    while (i < p.size()) {
+      if (s->status(stat) == SS_FAILED)
+        break;
+      unsigned int a = p[i++];
+      int n = static_cast<int>(p[i++]);
+      Archive e;
+      for (int j=0; j<n; j++)
+        e << p[i++];
+      const Choice* c = s->choice(e);
+      s->commit(*c,a);
+      delete c;
+    }
+    if (s->status(stat) == SS_FAILED) {
+      delete s;
+      return NULL;
+    }
+    return s;
+  }
+
+  /// Test whether solution \a s is better than \a b
+  bool
+  better(const Space& s, const Space& b) {
+    Space* c = s.clone();
+    c->constrain(b);
+    bool r = (c->status() != SS_FAILED);
+    delete c;
+    return r;
+  }
+
+  /// Add 64 bit statistics value \a v to \a a
+  void
+  put(Archive& a, unsigned long int v) {
+    unsigned long long int w = v;
+    a << static_cast<unsigned int>(w >> 32)
+      << static_cast<unsigned int>(w & 0xffffffffULL);
+  }
+
+  /// Get 64 bit statistics value from \a a
+  unsigned long int
+  get(Archive& a) {
+    unsigned int h, l;
+    a >> h >> l;
+    return static_cast<unsigned long int>
+      ((static_cast<unsigned long long int>(h) << 32) | l);
+  }
+
+
+  /// Master engine
+  class Master : public Engine {
+  protected:
+    /// Connected worker
+    class Client {
+    public:
+      /// Socket
+      int fd;
+      /// Whether the worker explores a subproblem
+      bool busy;
+      /// Path to the subproblem explored
+      Archive job;
+    };
+    /// Search options
+    Options opt;
+    /// Whether to search for best solutions
+    bool best;
+    /// Listening socket
+    int lfd;
+    /// Root space for reconstructing solutions
+    Space* root;
+    /// Paths to subproblems not yet explored
+    std::deque<Archive> jobs;
+    /// Connected workers
+    std::vector<Client> clients;
+    /// Solutions not yet reported
+    std::deque<Space*> sols;
+    /// Best solution so far
+    Space* b;
+    /// Path to best solution so far
+    Archive bpath;
+    /// Statistics
+    Statistics stat;
+    /// Whether search has been stopped
+    bool has_stopped;
+    /// Decompose \a s into at least \a n subproblems
+    void decompose(Space* s, unsigned int n);
+    /// Give jobs to idle workers
+    void dispatch(void);
+    /// Handle message from worker \a i, return false if worker is gone
+    bool handle(Client& c);
+  public:
+    /// Initialize for space \a s with options \a o
+    Master(Space* s, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~Master(void);
+  };
+
+  Master::Master(Space* s, const Options& o, bool b0)
+    : opt(o), best(b0), lfd(-1), root(NULL), b(NULL), has_stopped(false) {
+    // Start listening before the (possibly expensive) decomposition
+    struct addrinfo hints, *ai;
+    memset(&hints,0,sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    char p[16];
+    snprintf(p,sizeof(p),"%u",opt.port);
+    if (getaddrinfo(opt.address,p,&hints,&ai) != 0)
+      throw DistributedFailure("Search::Dist::Master");
+    for (struct addrinfo* a = ai; a != NULL; a = a->ai_next) {
+      lfd = socket(a->ai_family,a->ai_socktype,a->ai_protocol);
+      if (lfd < 0)
+        continue;
+      int yes = 1;
+      (void) setsockopt(lfd,SOL_SOCKET,SO_REUSEADDR,&yes,sizeof(yes));
+      if ((bind(lfd,a->ai_addr,a->ai_addrlen) == 0) &&
+          (listen(lfd,SOMAXCONN) == 0))
+        break;
+      close(lfd);
+      lfd = -1;
+    }
+    freeaddrinfo(ai);
+    if (lfd < 0)
+      throw DistributedFailure("Search::Dist::Master");
+    unsigned int n = opt.subproblems;
+    if (n == 0)
+      n = Config::subproblems * static_cast<unsigned int>(opt.threads);
+    stat.histograms(opt.instrument);
+    decompose(s,n);
+  }
+
+  void
+  Master::decompose(Space* s, unsigned int n) {
+    if ((s == NULL) || (s->status(stat) == SS_FAILED)) {
+      stat.failure(0);
+      if (!opt.clone)
+        delete s;
+      return;
+    }
+    root = snapshot(s,opt);
+    // Expand the tree level by level until there are enough subproblems
+    std::deque<std::pair<Space*,Archive> > q;
+    q.push_back(std::make_pair(root->clone(),Archive()));
+    bool branched = true;
+    unsigned long int d = 0;
+    while (branched && (q.size() < n)) {
+      branched = false;
+      d++;
+      for (size_t i=q.size(); i--; ) {
+        std::pair<Space*,Archive> p = q.front(); q.pop_front();
+        if (p.first->status(stat) == SS_SOLVED) {
+          q.push_back(p);
+          continue;
+        }
+        branched = true;
+        stat.node++;
+        const Choice* ch = p.first->choice();
+        Archive ca;
+        ch->archive(ca);
+        unsigned int alt = ch->alternatives();
+        for (unsigned int j=0; j<alt; j++) {
+          Space* t = (j+1 < alt) ? p.first->clone() : p.first;
+          t->commit(*ch,j);
+          if (t->status(stat) == SS_FAILED) {
+            stat.node++; stat.failure(d);
+            delete t;
+          } else {
+            q.push_back(std::make_pair(t,extend(p.second,j,ca)));
+          }
+        }
+        delete ch;
+      }
+    }
+    for (std::pair<Space*,Archive>& p : q) {
+      delete p.first;
+      jobs.push_back(p.second);
+    }
+  }
+
+  void
+  Master::dispatch(void) {
+    for (Client& c : clients)
+      if (!c.busy && !jobs.empty()) {
+        c.job = jobs.front(); jobs.pop_front();
+        c.busy = true;
+        // A failing worker is noticed when reading from it
+        (void) send(c.fd,M_JOB,c.job);
+      }
+  }
+
+  bool
+  Master::handle(Client& c) {
+    Message t;
+    Archive a;
+    if (!receive(c.fd,t,a))
+      return false;
+    switch (t) {
+    case W_DONE:
+      {
+        Statistics s;
+        s.node = get(a); s.fail = get(a); s.depth = get(a);
+        stat += s;
+        c.busy = false;
+      }
+      break;
+    case W_SOLUTION:
+      {
+        Statistics s;
+        Space* sol = replay(root->clone(),a,s);
+        if (sol == NULL)
+          break;
+        // The path must lead to a solution
+        if (sol->status(s) != SS_SOLVED) {
+          delete sol;
+          return false;
+        }
+        if (!best) {
+          sols.push_back(sol);
+        } else if ((b == NULL) || better(*sol,*b)) {
+          delete b;
+          b = sol->clone();
+          bpath = a;
+          for (Client& o : clients)
+            if (o.fd != c.fd)
+              (void) send(o.fd,M_BOUND,bpath);
+          sols.push_back(sol);
+        } else {
+          delete sol;
+        }
+      }
+      break;
+    default:
+      return false;
+    }
+    return true;
+  }
+
+  Space*
+  Master::next(void) {
+    has_stopped = false;
+    while (sols.empty()) {
+      bool busy = false;
+      for (Client& c : clients)
+        busy = busy || c.busy;
+      if (!busy && jobs.empty())
+        return NULL;
+      if ((opt.stop != NULL) && opt.stop->stop(stat,opt)) {
+        has_stopped = true;
+        return NULL;
+      }
+      fd_set fds;
+      FD_ZERO(&fds);
+      FD_SET(lfd,&fds);
+      int m = lfd;
+      for (Client& c : clients) {
+        FD_SET(c.fd,&fds);
+        m = std::max(m,c.fd);
+      }
+      // Wake up periodically to check the stop object
+      struct timeval tv;
+      tv.tv_sec = 0; tv.tv_usec = 100000;
+      if (select(m+1,&fds,NULL,NULL,&tv) <= 0)
+        continue;
+      if (FD_ISSET(lfd,&fds)) {
+        int fd = accept(lfd,NULL,NULL);
+        if (fd >= 0) {
+          int yes = 1;
+          (void) setsockopt(fd,IPPROTO_TCP,TCP_NODELAY,&yes,sizeof(yes));
+          Client c;
+          c.fd = fd; c.busy = false;
+          if (best && (b != NULL))
+            (void) send(fd,M_BOUND,bpath);
+          clients.push_back(c);
+        }
+      }
+      for (size_t i=0; i<clients.size(); ) {
+        Client& c = clients[i];
+        if (FD_ISSET(c.fd,&fds) && !handle(c)) {
+          // Worker is gone, its subproblem must be explored again
+          if (c.busy)
+            jobs.push_front(c.job);
+          close(c.fd);
+          clients.erase(clients.begin()+static_cast<long int>(i));
+        } else {
+          i++;
+        }
+      }
+      dispatch();
+    }
+    Space* s = sols.front(); sols.pop_front();
+    return s;
+  }
+
+  Statistics
+  Master::statistics(void) const {
+    return stat;
+  }
+
+  bool
+  Master::stopped(void) const {
+    return has_stopped;
+  }
+
+  Master::~Master(void) {
+    for (Client& c : clients) {
+      (void) send(c.fd,M_QUIT,Archive());
+      close(c.fd);
+    }
+    close(lfd);
+    delete root;
+    delete b;
+    for (Space* s : sols)
+      delete s;
+  }
+
+
+  /// Worker
+  class Worker {
+  protected:
+    /// Stop object checking for messages while exploring a subproblem
+    class Poll : public Stop {
+    protected:
+      /// The worker
+      Worker& w;
+      /// Number of nodes explored since last check for messages
+      unsigned int n;
+    public:
+      /// Initialize for worker \a w
+      Poll(Worker& w);
+      /// Stop if master has quit or sent a better solution
+      virtual bool stop(const Statistics& s, const Options& o);
+    };
+    /// Socket
+    int fd;
+    /// Whether to search for best solutions
+    bool best;
+    /// Best solution so far
+    Space* b;
+    /// Version of best solution
+    unsigned long int version;
+    /// Version of best solution the engine is constrained by
+    unsigned long int v;
+    /// Whether the master has quit
+    bool quit;
+    /// Explore space \a s with path \a p by engine \a E with statistics \a st
+    template<class E>
+    void explore(Space* s, const Archive& p, Statistics& st);
+  public:
+    /// The root space
+    Space* root;
+    /// Initialize
+    Worker(int fd, Space* root, bool best);
+    /// Handle message of type \a t with contents \a a
+    void handle(Message t, Archive& a);
+    /// Handle all messages that are available without blocking
+    void poll(void);
+    /// Explore subproblems until master quits
+    void run(void);
+    /// Destructor
+    ~Worker(void);
+  };
+
+  Worker::Poll::Poll(Worker& w0)
+    : w(w0), n(0) {}
+
+  bool
+  Worker::Poll::stop(const Statistics&, const Options&) {
+    if ((++n & 63) == 0)
+      w.poll();
+    return w.quit || (w.best && (w.v != w.version));
+  }
+
+  Worker::Worker(int fd0, Space* r, bool b0)
+    : fd(fd0), best(b0), b(NULL), version(0), v(0), quit(false),
+      root(r) {}
+
+  void
+  Worker::handle(Message t, Archive& a) {
+    switch (t) {
+    case M_BOUND:
+      {
+        Statistics st;
+        if (Space* s = replay(root->clone(),a,st)) {
+          if ((s->status(st) == SS_SOLVED) &&
+              ((b == NULL) || better(*s,*b))) {
+            delete b; b = s; version++;
+          } else {
+            delete s;
+          }
+        }
+      }
+      break;
+    case M_QUIT:
+      quit = true;
+      break;
+    default:
+      break;
+    }
+  }
+
+  void
+  Worker::poll(void) {
+    while (!quit && readable(fd)) {
+      Message t;
+      Archive a;
+      if (!receive(fd,t,a))
+        quit = true;
+      else
+        handle(t,a);
+    }
+  }
+
+  template<class E>
+  void
+  Worker::explore(Space* s, const Archive& p, Statistics& st) {
+    Poll ps(*this);
+    Options o;
+    o.clone = false;
+    o.stop = &ps;
+    E e(s,o);
+    e.record();
+    v = version;
+    if (best && (b != NULL))
+      e.constrain(*b);
+    while (!quit) {
+      if (Space* t = e.next()) {
+        // Extend path by path to solution (without its number of edges)
+        Archive sp(p);
+        const Archive& ep = e.solution();
+        for (int i=1; i<ep.size(); i++)
+          sp << ep[i];
+        if (!send(fd,W_SOLUTION,sp))
+          quit = true;
+        if (best) {
+          delete b; b = t; v = ++version;
+        } else {
+          delete t;
+        }
+      } else if (e.stopped()) {
+        // A better solution has been received
+        if (!quit && best && (v != version)) {
+          v = version;
+          e.constrain(*b);
+        }
+      } else {
+        break;
+      }
+    }
+    st = e.statistics();
+  }
+
+  void
+  Worker::run(void) {
+    while (!quit) {
+      Message t;
+      Archive a;
+      if (!receive(fd,t,a))
+        break;
+      if (t != M_JOB) {
+        handle(t,a);
+        continue;
+      }
+      Statistics st;
+      if (Space* s = replay(root->clone(),a,st)) {
+        if (best)
+          explore<Seq::BAB<NoTraceRecorder> >(s,a,st);
+        else
+          explore<Seq::DFS<NoTraceRecorder> >(s,a,st);
+      }
+      if (quit)
+        break;
+      Archive r;
+      put(r,st.node); put(r,st.fail); put(r,st.depth);
+      if (!send(fd,W_DONE,r))
+        break;
+    }
+  }
+
+  Worker::~Worker(void) {
+    delete b;
+    delete root;
+  }
+
+}
+
+  Engine*
+  distengine(Space* s, const Options& o, bool best) {
+    return new Dist::Master(s,o.expand(),best);
+  }
+
+  void
+  distworker(Space* s, const char* host, unsigned int port, bool best) {
+    if (s->status() == SS_FAILED) {
+      delete s;
+      return;
+    }
+    struct addrinfo hints, *ai;
+    memset(&hints,0,sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    char p[16];
+    snprintf(p,sizeof(p),"%u",port);
+    if (getaddrinfo(host,p,&hints,&ai) != 0) {
+      delete s;
+      throw DistributedFailure("Search::distworker");
+    }
+    // The master might not be listening yet
+    int fd = -1;
+    for (int i=0; (fd < 0) && (i < 100); i++) {
+      for (struct addrinfo* a = ai; a != NULL; a = a->ai_next) {
+        fd = socket(a->ai_family,a->ai_socktype,a->ai_protocol);
+        if (fd < 0)
+          continue;
+        if (connect(fd,a->ai_addr,a->ai_addrlen) == 0)
+          break;
+        close(fd);
+        fd = -1;
+      }
+      if (fd < 0)
+        usleep(50000);
+    }
+    freeaddrinfo(ai);
+    if (fd < 0) {
+      delete s;
+      throw DistributedFailure("Search::distworker");
+    }
+    int yes = 1;
+    (void) setsockopt(fd,IPPROTO_TCP,TCP_NODELAY,&yes,sizeof(yes));
+    {
+      Dist::Worker w(fd,s,best);
+      w.run();
+    }
+    close(fd);
+  }
+
+}}
+
+#else
+
+namespace Gecode { namespace Search {
+
+  Engine*
+  distengine(Space* s, const Options&, bool) {
+    delete s;
+    throw DistributedFailure("Search::distengine");
+  }
+
+  void
+  distworker(Space* s, const char*, unsigned int, bool) {
+    delete s;
+    throw DistributedFailure("Search::distworker");
+  }
+
+}}
+
+#endif
+
+// STATISTICS: search-other
@@ -0,0 +1,61 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Search {
+
+  /// Create master engine for distributed search
+  GECODE_SEARCH_EXPORT Engine*
+  distengine(Space* s, const Options& o, bool best);
+
+  /// Run worker for distributed search for root \a s
+  GECODE_SEARCH_EXPORT void
+  distworker(Space* s, const char* host, unsigned int port, bool best);
+
+}}
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  Dist<T,E>::Dist(T* s, const Search::Options& o)
+    : Search::Base<T>(Search::distengine(s,o,E<T>::best)) {}
+
+  template<class T, template<class> class E>
+  inline void
+  distworker(T* s, const std::string& host, unsigned int port) {
+    Search::distworker(s,host.c_str(),port,E<T>::best);
+  }
+
+}
+
+// STATISTICS: search-other
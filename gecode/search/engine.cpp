@@ -48,6 +48,15 @@ namespace Gecode { namespace Search {
   Engine::nogoods(void) {
     return NoGoods::eng;
   }
+  unsigned int
+  Engine::assets(void) const {
+    return 0U;
+  }
+  Statistics
+  Engine::asset(unsigned int a) const {
+    (void) a;
+    return Statistics();
+  }
 
 }}
 
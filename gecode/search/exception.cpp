@@ -38,6 +38,13 @@ namespace Gecode { namespace Search {
   UninitializedCutoff::UninitializedCutoff(const char* l)
     : Exception(l,"Cutoff for restart-based search is missing") {}
 
+  UncopiableCutoff::UncopiableCutoff(const char* l)
+    : Exception(l,"Cutoff for independent restarts cannot be copied") {}
+
+  UninitializedNeighborhoods::UninitializedNeighborhoods(const char* l)
+    : Exception(l,"Neighborhoods for large neighborhood search are missing")
+  {}
+
   NoAssets::NoAssets(const char* l)
     : Exception(l,"No assets requested in portfolio") {}
 
@@ -48,6 +55,12 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  DistributedFailure::DistributedFailure(const char* l)
+    : Exception(l,"Communication for distributed search failed") {}
+
+  CheckpointFailure::CheckpointFailure(const char* l)
+    : Exception(l,"Reading or writing a checkpoint failed") {}
+
 }}
 
 // STATISTICS: search-other
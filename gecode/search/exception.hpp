@@ -44,6 +44,18 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     UninitializedCutoff(const char* l);
   };
+  /// %Exception: Cutoff for independent restarts cannot be copied
+  class GECODE_SEARCH_EXPORT UncopiableCutoff : public Exception {
+  public:
+    /// Initialize with location \a l
+    UncopiableCutoff(const char* l);
+  };
+  /// %Exception: Uninitialized neighborhoods for large neighborhood search
+  class GECODE_SEARCH_EXPORT UninitializedNeighborhoods : public Exception {
+  public:
+    /// Initialize with location \a l
+    UninitializedNeighborhoods(const char* l);
+  };
   /// %Exception: No assets requested for portfolio-based search
   class GECODE_SEARCH_EXPORT NoAssets : public Exception {
   public:
@@ -62,6 +74,18 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Communication for distributed search failed
+  class GECODE_SEARCH_EXPORT DistributedFailure : public Exception {
+  public:
+    /// Initialize with location \a l
+    DistributedFailure(const char* l);
+  };
+  /// %Exception: Reading or writing a checkpoint failed
+  class GECODE_SEARCH_EXPORT CheckpointFailure : public Exception {
+  public:
+    /// Initialize with location \a l
+    CheckpointFailure(const char* l);
+  };
   //@}
 }}
 
@@ -39,10 +39,19 @@
 
 #include <gecode/search/seq/lds.hh>
 
+#ifdef GECODE_HAS_THREADS
+#include <gecode/search/par/lds.hh>
+#endif
+
 namespace Gecode { namespace Search {
 
   Engine*
   ldsengine(Space* s, const Options& o) {
+#ifdef GECODE_HAS_THREADS
+    Options to = o.expand();
+    if ((to.threads > 1.0) && !to.tracer)
+      return new Par::LDS(s,to);
+#endif
     if (o.tracer)
       return new Seq::LDS<EdgeTraceRecorder>(s,o);
     else
@@ -0,0 +1,245 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/seq/lns.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Gecode { namespace Search {
+
+  /*
+   * Neighborhoods
+   *
+   */
+  Neighborhood::Neighborhood(void) {}
+
+  Neighborhood::~Neighborhood(void) {}
+
+
+  /// Neighborhoods shared by copies for several threads
+  class Neighborhoods::Shared : public Support::RefCount,
+                                public HeapAllocated {
+  public:
+    /// Number of neighborhoods
+    unsigned int n;
+    /// The neighborhoods
+    Neighborhood** ns;
+    /// Initialize with neighborhoods \a n
+    Shared(const std::vector<Neighborhood*>& n);
+    /// Delete neighborhoods
+    ~Shared(void);
+  };
+
+  Neighborhoods::Shared::Shared(const std::vector<Neighborhood*>& n0)
+    : Support::RefCount(1),
+      n(static_cast<unsigned int>(n0.size())),
+      ns(heap.alloc<Neighborhood*>(n)) {
+    for (unsigned int i=0; i<n; i++)
+      ns[i] = n0[i];
+  }
+
+  Neighborhoods::Shared::~Shared(void) {
+    for (unsigned int i=0; i<n; i++)
+      delete ns[i];
+    heap.free<Neighborhood*>(ns,n);
+  }
+
+
+  Neighborhoods::Neighborhoods(const std::vector<Neighborhood*>& n,
+                               double r1, unsigned int s1)
+    : sh(new Shared(n)), r(heap.alloc<double>(sh->n)),
+      r0(r1), s(s1), rnd(s1) {
+    if (sh->n == 0) {
+      heap.free<double>(r,0);
+      delete sh;
+      throw Search::UninitializedNeighborhoods("Neighborhoods");
+    }
+    for (unsigned int i=0; i<sh->n; i++)
+      r[i] = r0;
+  }
+
+  Neighborhoods::Neighborhoods(const Neighborhoods& n, unsigned int i)
+    : sh(n.sh), r(heap.alloc<double>(n.sh->n)),
+      r0(n.r0), s(n.s+i), rnd(n.s+i) {
+    sh->inc();
+    for (unsigned int j=0; j<sh->n; j++)
+      r[j] = r0;
+  }
+
+  unsigned int
+  Neighborhoods::size(void) const {
+    return sh->n;
+  }
+
+  double
+  Neighborhoods::ratio(unsigned int i) const {
+    return r[i];
+  }
+
+  bool
+  Neighborhoods::relax(unsigned int i, Space& home, const Space& sol) {
+    return sh->ns[i]->relax(home,sol,r[i],rnd);
+  }
+
+  void
+  Neighborhoods::reward(unsigned int, double) {}
+
+  void
+  Neighborhoods::improved(unsigned int i, double v) {
+    reward(i,v);
+  }
+
+  void
+  Neighborhoods::exhausted(unsigned int i) {
+    // Neighborhood has been too small
+    r[i] = std::min(1.0, r[i] * Config::lns_adapt);
+    reward(i,0.0);
+  }
+
+  void
+  Neighborhoods::limited(unsigned int i) {
+    // Neighborhood has been too large
+    r[i] = std::max(Config::lns_ratio_min, r[i] / Config::lns_adapt);
+    reward(i,0.0);
+  }
+
+  Neighborhoods::~Neighborhoods(void) {
+    heap.free<double>(r,sh->n);
+    if (sh->dec())
+      delete sh;
+  }
+
+  Neighborhoods*
+  Neighborhoods::uniform(const std::vector<Neighborhood*>& n,
+                         double r, unsigned int s) {
+    return new NeighborhoodsUniform(n,r,s);
+  }
+
+  Neighborhoods*
+  Neighborhoods::bandit(const std::vector<Neighborhood*>& n,
+                        double r, double e, unsigned int s) {
+    return new NeighborhoodsBandit(n,r,e,s);
+  }
+
+
+  NeighborhoodsUniform::NeighborhoodsUniform
+  (const std::vector<Neighborhood*>& n, double r, unsigned int s)
+    : Neighborhoods(n,r,s) {}
+
+  NeighborhoodsUniform::NeighborhoodsUniform
+  (const NeighborhoodsUniform& n, unsigned int i)
+    : Neighborhoods(n,i) {}
+
+  unsigned int
+  NeighborhoodsUniform::select(void) {
+    return rnd(size());
+  }
+
+  Neighborhoods*
+  NeighborhoodsUniform::copy(unsigned int i) const {
+    return new NeighborhoodsUniform(*this,i);
+  }
+
+
+  NeighborhoodsBandit::NeighborhoodsBandit
+  (const std::vector<Neighborhood*>& n0, double r, double e0,
+   unsigned int s)
+    : Neighborhoods(n0,r,s), e(e0),
+      n(heap.alloc<unsigned long int>(size())),
+      v(heap.alloc<double>(size())), t(0UL) {
+    for (unsigned int i=0; i<size(); i++) {
+      n[i] = 0UL; v[i] = 0.0;
+    }
+  }
+
+  NeighborhoodsBandit::NeighborhoodsBandit
+  (const NeighborhoodsBandit& nb, unsigned int i)
+    : Neighborhoods(nb,i), e(nb.e),
+      n(heap.alloc<unsigned long int>(size())),
+      v(heap.alloc<double>(size())), t(0UL) {
+    for (unsigned int j=0; j<size(); j++) {
+      n[j] = 0UL; v[j] = 0.0;
+    }
+  }
+
+  void
+  NeighborhoodsBandit::reward(unsigned int i, double x) {
+    n[i]++; t++;
+    v[i] += (x - v[i]) / static_cast<double>(n[i]);
+  }
+
+  unsigned int
+  NeighborhoodsBandit::select(void) {
+    // Use every neighborhood at least once
+    for (unsigned int i=0; i<size(); i++)
+      if (n[i] == 0UL)
+        return i;
+    // Select by upper confidence bound
+    double l = std::log(static_cast<double>(t));
+    unsigned int b = 0;
+    double bv = 0.0;
+    for (unsigned int i=0; i<size(); i++) {
+      double u = v[i] + e * std::sqrt(2.0 * l / static_cast<double>(n[i]));
+      if ((i == 0) || (u > bv)) {
+        b = i; bv = u;
+      }
+    }
+    return b;
+  }
+
+  Neighborhoods*
+  NeighborhoodsBandit::copy(unsigned int i) const {
+    return new NeighborhoodsBandit(*this,i);
+  }
+
+  NeighborhoodsBandit::~NeighborhoodsBandit(void) {
+    heap.free<unsigned long int>(n,size());
+    heap.free<double>(v,size());
+  }
+
+}}
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  Engine*
+  lnsengine(Space* master, Stop* stop, Engine* slave,
+            const Search::Statistics& stat, const Options& opt, bool best) {
+    return new LNS(master,static_cast<RestartStop*>(stop),slave,
+                   stat,opt,best);
+  }
+
+}}}
+
+// STATISTICS: search-other
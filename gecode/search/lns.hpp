@@ -0,0 +1,166 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  /// Create large neighborhood search engine
+  GECODE_SEARCH_EXPORT Engine*
+  lnsengine(Space* master, Stop* stop, Engine* slave,
+            const Search::Statistics& stat, const Options& opt,
+            bool best);
+
+}}}
+
+namespace Gecode { namespace Search {
+
+  /// A LNS engine builder
+  template<class T, template<class> class E>
+  class LnsBuilder : public Builder {
+    using Builder::opt;
+  public:
+    /// The constructor
+    LnsBuilder(const Options& opt);
+    /// The actual build function
+    virtual Engine* operator() (Space* s) const;
+  };
+
+  template<class T, template<class> class E>
+  inline
+  LnsBuilder<T,E>::LnsBuilder(const Options& opt)
+    : Builder(opt,true) {}
+
+  template<class T, template<class> class E>
+  Engine*
+  LnsBuilder<T,E>::operator() (Space* s) const {
+    return build<T,LNS<T,E> >(s,opt);
+  }
+
+#ifdef GECODE_HAS_THREADS
+
+  /// Create parallel large neighborhood search engine
+  template<class T, template<class> class E>
+  Engine*
+  lnspar(T* s, const Options& o) {
+    Options opt(o.expand());
+    Search::Statistics stat;
+
+    stat.histograms(opt.instrument);
+    if (s->status(stat) == SS_FAILED) {
+      stat.failure(0);
+      if (!opt.clone)
+        delete s;
+      return Seq::dead(opt, stat);
+    }
+
+    T* master = opt.clone ? dynamic_cast<T*>(s->clone()) : s;
+    opt.clone = false;
+    // No portfolio master function, it might kill the branchers the
+    // engines share: each engine runs the master function on restarts
+
+    // One engine per thread with its own neighborhoods and cutoff
+    int n = static_cast<int>(opt.threads);
+    SEBs sebs(n);
+    for (int i=0; i<n; i++) {
+      Options so(opt);
+      so.threads = 1.0;
+      if (i > 0) {
+        so.neighborhoods =
+          opt.neighborhoods->copy(static_cast<unsigned int>(i));
+        so.cutoff = (opt.cutoff != NULL) ?
+          opt.cutoff->copy(static_cast<unsigned int>(i)) : NULL;
+      }
+      sebs[i] = new LnsBuilder<T,E>(so);
+    }
+
+    return pbspar<T,E>(master,sebs,stat,opt,true);
+  }
+
+#endif
+
+}}
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  LNS<T,E>::LNS(T* s, const Search::Options& m_opt) {
+    if (m_opt.neighborhoods == NULL)
+      throw Search::UninitializedNeighborhoods("LNS::LNS");
+#ifdef GECODE_HAS_THREADS
+    if (m_opt.expand().threads > 1.0) {
+      e = Search::lnspar<T,E>(s,m_opt);
+      return;
+    }
+#endif
+    Search::Options e_opt(m_opt.expand());
+    Search::Statistics stat;
+    e_opt.clone = false;
+    e_opt.checkpoint = NULL;
+    e_opt.stop  = Search::Seq::rbsstop(m_opt.stop);
+    Search::WrapTraceRecorder::engine(e_opt.tracer,
+                                      SearchTracer::EngineType::RBS, 1U);
+    stat.histograms(m_opt.instrument);
+    if (s->status(stat) == SS_FAILED) {
+      stat.failure(0);
+      if (!m_opt.clone)
+        delete s;
+      e = Search::Seq::dead(e_opt, stat);
+    } else {
+      Space* master = m_opt.clone ? s->clone() : s;
+      Space* slave  = master->clone();
+      e = Search::Seq::lnsengine(master,e_opt.stop,
+                                 Search::build<T,E>(slave,e_opt),
+                                 stat,m_opt,E<T>::best);
+    }
+  }
+
+
+  template<class T, template<class> class E>
+  inline T*
+  lns(T* s, const Search::Options& o) {
+    LNS<T,E> l(s,o);
+    return l.next();
+  }
+
+  template<class T, template<class> class E>
+  SEB
+  lns(const Search::Options& o) {
+    if (o.neighborhoods == NULL)
+      throw Search::UninitializedNeighborhoods("lns");
+    return new Search::LnsBuilder<T,E>(o);
+  }
+
+}
+
+// STATISTICS: search-seq
@@ -33,6 +33,9 @@
 
 #include <gecode/search/nogoods.hh>
 
+#include <algorithm>
+#include <iterator>
+
 namespace Gecode { namespace Search {
 
   /// Help function to cancel and dispose a no-good literal
@@ -217,6 +220,390 @@ namespace Gecode { namespace Search {
     return sizeof(*this);
   }
 
+
+
+  /*
+   * No-goods with watched literals
+   *
+   */
+  Actor*
+  WatchedNoGoodsProp::copy(Space& home) {
+    return new (home) WatchedNoGoodsProp(home,*this);
+  }
+
+  PropCost
+  WatchedNoGoodsProp::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,n);
+  }
+
+  void
+  WatchedNoGoodsProp::reschedule(Space& home) {
+    for (int i=0; i<n; i++) {
+      ng[i].l[0]->reschedule(home,*this);
+      ng[i].l[1]->reschedule(home,*this);
+    }
+  }
+
+  ExecStatus
+  WatchedNoGoodsProp::watch(Space& home, NoGood& g, bool& s) {
+    // The no-good has been dropped from the store
+    s = g.a->dropped.load(std::memory_order_relaxed);
+    if (s)
+      return ES_OK;
+    for (int w=0; w<2; w++)
+      switch (g.l[w]->status(home)) {
+      case NGL::FAILED:
+        s = true;
+        return ES_OK;
+      case NGL::SUBSUMED:
+        {
+          // Find another literal to watch
+          int i = 2;
+          while (i < g.n) {
+            NGL::Status t = g.l[i]->status(home);
+            if (t == NGL::FAILED) {
+              s = true;
+              return ES_OK;
+            }
+            if (t == NGL::NONE)
+              break;
+            i++;
+          }
+          if (i < g.n) {
+            g.l[w]->cancel(home,*this);
+            std::swap(g.l[w],g.l[i]);
+            g.l[w]->subscribe(home,*this);
+            break;
+          }
+          // All literals but the other watched literal are subsumed
+          NGL* o = g.l[1-w];
+          switch (o->status(home)) {
+          case NGL::FAILED:
+            s = true;
+            return ES_OK;
+          case NGL::SUBSUMED:
+            return ES_FAILED;
+          case NGL::NONE:
+            g.a->hits.fetch_add(1UL,std::memory_order_relaxed);
+            s = true;
+            return o->prune(home);
+          default: GECODE_NEVER;
+          }
+        }
+        break;
+      case NGL::NONE:
+        break;
+      default: GECODE_NEVER;
+      }
+    return ES_OK;
+  }
+
+  void
+  WatchedNoGoodsProp::release(Space& home, NoGood& g) {
+    g.l[0]->cancel(home,*this);
+    g.l[1]->cancel(home,*this);
+    for (int i=0; i<g.n; i++)
+      home.rfree(g.l[i],g.l[i]->dispose(home));
+    home.free<NGL*>(g.l,g.n);
+    g.a->cancel();
+  }
+
+  ExecStatus
+  WatchedNoGoodsProp::propagate(Space& home, const ModEventDelta&) {
+    bool pruned = false;
+    int j = 0;
+    for (int i=0; i<n; i++) {
+      bool s;
+      if (watch(home,ng[i],s) == ES_FAILED) {
+        // Keep all no-goods not yet released
+        while (i < n)
+          ng[j++] = ng[i++];
+        n = j;
+        return ES_FAILED;
+      }
+      if (s) {
+        pruned = true;
+        release(home,ng[i]);
+      } else {
+        ng[j++] = ng[i];
+      }
+    }
+    if (j == 0) {
+      home.free<NoGood>(ng,n);
+      n = 0;
+      return home.ES_SUBSUMED(*this);
+    }
+    if (j < n) {
+      ng = home.realloc<NoGood>(ng,n,j);
+      n = j;
+    }
+    // Pruning might have subsumed literals of no-goods already checked
+    return pruned ? ES_NOFIX : ES_FIX;
+  }
+
+  ExecStatus
+  WatchedNoGoodsProp::post(Space& home, NoGood* ng, int n) {
+    int m = n;
+    // Simplify until no literal is pruned
+    bool pruned = true;
+    while (pruned && (n > 0)) {
+      pruned = false;
+      int j = 0;
+      for (int i=0; i<n; i++) {
+        NoGood& g = ng[i];
+        // Drop subsumed literals, a failed literal satisfies the no-good
+        bool sat = false;
+        int k = 0;
+        for (int h=0; h<g.n; h++) {
+          NGL::Status s = sat ? NGL::FAILED : g.l[h]->status(home);
+          if (s == NGL::NONE) {
+            g.l[k++] = g.l[h];
+          } else {
+            sat = sat || (s == NGL::FAILED);
+            home.rfree(g.l[h],g.l[h]->dispose(home));
+          }
+        }
+        if (sat || (k < 2)) {
+          ExecStatus es = ES_OK;
+          if (sat) {
+            for (int h=0; h<k; h++)
+              home.rfree(g.l[h],g.l[h]->dispose(home));
+          } else if (k == 0) {
+            es = ES_FAILED;
+          } else {
+            g.a->hits.fetch_add(1UL,std::memory_order_relaxed);
+            es = g.l[0]->prune(home);
+            home.rfree(g.l[0],g.l[0]->dispose(home));
+            pruned = true;
+          }
+          home.free<NGL*>(g.l,g.n);
+          if (es == ES_FAILED)
+            return ES_FAILED;
+        } else {
+          g.l = home.realloc<NGL*>(g.l,g.n,k);
+          g.n = k;
+          ng[j++] = g;
+        }
+      }
+      n = j;
+    }
+    if (n == 0) {
+      home.free<NoGood>(ng,m);
+      return ES_OK;
+    }
+    ng = home.realloc<NoGood>(ng,m,n);
+    (void) new (home) WatchedNoGoodsProp(home,ng,n);
+    return ES_OK;
+  }
+
+  size_t
+  WatchedNoGoodsProp::dispose(Space& home) {
+    if (home.failed()) {
+      for (int i=0; i<n; i++) {
+        for (int j=0; j<ng[i].n; j++)
+          (void) ng[i].l[j]->dispose(home);
+        ng[i].a->cancel();
+      }
+    } else {
+      for (int i=0; i<n; i++)
+        release(home,ng[i]);
+      home.free<NoGood>(ng,n);
+    }
+    home.ignore(*this,AP_DISPOSE);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Stored no-goods
+   *
+   */
+  StoredNoGoods::StoredNoGoods(unsigned int c, double d)
+    : capacity(c), decay(d), inc(1.0), stamp(0UL) {}
+
+  void
+  StoredNoGoods::add(const std::vector<unsigned int>& ng) {
+    std::map<std::vector<unsigned int>,Entry>::iterator i = ngs.find(ng);
+    if (i != ngs.end()) {
+      // Recorded again
+      i->second.activity += inc;
+      return;
+    }
+    Entry e;
+    e.activity = inc; e.hits = 0UL; e.stamp = ++stamp;
+    e.a = new NoGoodActivity;
+    age.insert(std::make_pair(e.stamp,ngs.insert(std::make_pair(ng,e)).first));
+  }
+
+  void
+  StoredNoGoods::decrease(void) {
+    /*
+     * Rather than decaying all activities, the increment for
+     * activities grows. Only if it becomes too large, the activities
+     * are rescaled.
+     */
+    inc /= decay;
+    if (inc > 1e100) {
+      for (std::map<std::vector<unsigned int>,Entry>::iterator
+             i = ngs.begin(); i != ngs.end(); ++i)
+        i->second.activity /= inc;
+      inc = 1.0;
+    }
+  }
+
+  /// Order no-goods by increasing activity and then by age
+  class LessActive {
+  public:
+    /// Compare \a x and \a y
+    bool operator ()(std::map<std::vector<unsigned int>,
+                              StoredNoGoods::Entry>::iterator x,
+                     std::map<std::vector<unsigned int>,
+                              StoredNoGoods::Entry>::iterator y) const {
+      return ((x->second.activity < y->second.activity) ||
+              ((x->second.activity == y->second.activity) &&
+               (x->second.stamp < y->second.stamp)));
+    }
+  };
+
+  void
+  StoredNoGoods::shrink(void) {
+    if (ngs.size() <= capacity)
+      return;
+    std::vector<std::map<std::vector<unsigned int>,Entry>::iterator> o;
+    o.reserve(ngs.size());
+    for (std::map<std::vector<unsigned int>,Entry>::iterator
+           i = ngs.begin(); i != ngs.end(); ++i) {
+      // Account for prunings since the last time the store was shrunk
+      Entry& x = i->second;
+      unsigned long int h = x.a->hits.load(std::memory_order_relaxed);
+      x.activity += static_cast<double>(h - x.hits) * inc;
+      x.hits = h;
+      o.push_back(i);
+    }
+    size_t d = ngs.size() - capacity;
+    std::nth_element(o.begin(),o.begin()+static_cast<long int>(d),o.end(),
+                     LessActive());
+    for (size_t i=0; i<d; i++) {
+      // Propagators for dropped no-goods will be subsumed
+      o[i]->second.a->dropped.store(true,std::memory_order_relaxed);
+      o[i]->second.a->cancel();
+      age.erase(o[i]->second.stamp);
+      ngs.erase(o[i]);
+    }
+  }
+
+  StoredNoGoods::~StoredNoGoods(void) {
+    for (std::map<std::vector<unsigned int>,Entry>::iterator
+           i = ngs.begin(); i != ngs.end(); ++i)
+      i->second.a->cancel();
+  }
+
+
+  /*
+   * No-good store
+   *
+   */
+  NoGoodStore::NoGoodStore(unsigned int c, double d)
+    : s(new StoredNoGoods(c,d)) {}
+
+  void
+  NoGoodStore::record(const NoGoods& ng) {
+    Archive e;
+    ng.archive(e);
+    Support::Lock l(m);
+    s->decrease();
+    if (e.size() > 0) {
+      /*
+       * For each edge on the path, each alternative to the left of
+       * the current one together with the edges above is a no-good.
+       */
+      std::vector<unsigned int> p;
+      int k = 0;
+      int n = static_cast<int>(e[k++]);
+      for (int i=0; i<n; i++) {
+        unsigned int t = e[k++];
+        unsigned int c = e[k++];
+        for (unsigned int a=0U; a<t; a++) {
+          std::vector<unsigned int> ng(p);
+          ng.push_back(a); ng.push_back(c);
+          for (unsigned int j=0U; j<c; j++)
+            ng.push_back(e[k+static_cast<int>(j)]);
+          s->add(ng);
+        }
+        p.push_back(t); p.push_back(c);
+        for (unsigned int j=0U; j<c; j++)
+          p.push_back(e[k++]);
+      }
+    }
+    s->shrink();
+  }
+
+  unsigned long int
+  NoGoodStore::post(Space& home, unsigned long int& t) const {
+    Support::Lock l(m);
+    // Only the no-goods recorded after stamp t
+    std::map<unsigned long int,
+             std::map<std::vector<unsigned int>,StoredNoGoods::Entry>
+             ::iterator>::const_iterator f = s->age.upper_bound(t);
+    t = s->stamp;
+    int n = static_cast<int>(std::distance(f,s->age.cend()));
+    if ((n == 0) || home.failed())
+      return 0UL;
+    WatchedNoGoodsProp::NoGood* g = home.alloc<WatchedNoGoodsProp::NoGood>(n);
+    int m = 0;
+    for ( ; f != s->age.cend(); ++f) {
+      const std::vector<unsigned int>& ng = f->second->first;
+      int k = 0;
+      for (size_t i=0; i<ng.size(); i += 2U+ng[i+1])
+        k++;
+      NGL** ls = home.alloc<NGL*>(k);
+      int j = 0;
+      for (size_t i=0; i<ng.size(); i += 2U+ng[i+1]) {
+        Archive c;
+        for (unsigned int w=0U; w<ng[i+1]; w++)
+          c << ng[i+2+w];
+        NGL* x = NULL;
+        try {
+          const Choice* ch = home.choice(c);
+          x = home.ngl(*ch,ng[i]);
+          delete ch;
+        } catch (Exception&) {
+          // The no-good does not match the branchers of the space
+        }
+        if (x == NULL)
+          break;
+        ls[j++] = x;
+      }
+      if (j < k) {
+        for (int h=0; h<j; h++)
+          home.rfree(ls[h],ls[h]->dispose(home));
+        home.free<NGL*>(ls,k);
+        continue;
+      }
+      g[m].l = ls; g[m].n = k; g[m].a = f->second->second.a;
+      m++;
+    }
+    if (m == 0) {
+      home.free<WatchedNoGoodsProp::NoGood>(g,n);
+      return 0UL;
+    }
+    g = home.realloc<WatchedNoGoodsProp::NoGood>(g,n,m);
+    if (WatchedNoGoodsProp::post(home,g,m) == ES_FAILED)
+      home.fail();
+    return static_cast<unsigned long int>(m);
+  }
+
+  unsigned int
+  NoGoodStore::size(void) const {
+    Support::Lock l(m);
+    return static_cast<unsigned int>(s->ngs.size());
+  }
+
+  NoGoodStore::~NoGoodStore(void) {
+    delete s;
+  }
+
 }}
 
 // STATISTICS: search-other
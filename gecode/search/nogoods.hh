@@ -36,6 +36,10 @@
 
 #include <gecode/search.hh>
 
+#include <atomic>
+#include <map>
+#include <vector>
+
 namespace Gecode { namespace Search {
 
   /// Class for a sentinel no-good literal
@@ -84,6 +88,122 @@ namespace Gecode { namespace Search {
     /// Post propagator for path \a p
     template<class Path>
     static ExecStatus post(Space& home, const Path& p);
+    /// Archive no-goods for path \a p into \a e
+    template<class Path>
+    static void archive(const Path& p, Archive& e);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /// Activity information shared by a stored no-good and its propagators
+  class NoGoodActivity {
+  public:
+    /// References by the store and by propagators
+    Support::RefCount rc;
+    /// How often the no-good has pruned
+    std::atomic<unsigned long int> hits;
+    /// Whether the no-good has been dropped from the store
+    std::atomic<bool> dropped;
+    /// Initialize with a single reference
+    NoGoodActivity(void);
+    /// Add a reference
+    void subscribe(void);
+    /// Remove a reference and delete if it was the last one
+    void cancel(void);
+  };
+
+  /// No-goods in a no-good store
+  class StoredNoGoods {
+  public:
+    /// A stored no-good
+    class Entry {
+    public:
+      /// Activity (relative to the current activity increment)
+      double activity;
+      /// Number of prunings already accounted for in the activity
+      unsigned long int hits;
+      /// When the no-good was recorded
+      unsigned long int stamp;
+      /// Activity information shared with propagators
+      NoGoodActivity* a;
+    };
+    /**
+     * \brief The no-goods
+     *
+     * A no-good is represented by its literals, each literal by its
+     * alternative, the size of its archived choice, and the choice.
+     */
+    std::map<std::vector<unsigned int>,Entry> ngs;
+    /// The no-goods ordered by their stamps
+    std::map<unsigned long int,
+             std::map<std::vector<unsigned int>,Entry>::iterator> age;
+    /// Maximal number of no-goods
+    unsigned int capacity;
+    /// Activity decay
+    double decay;
+    /// Activity increment (grows instead of decaying all activities)
+    double inc;
+    /// Current stamp
+    unsigned long int stamp;
+    /// Initialize with capacity \a c and decay \a d
+    StoredNoGoods(unsigned int c, double d);
+    /// Add no-good \a ng
+    void add(const std::vector<unsigned int>& ng);
+    /// Decay the activities of all no-goods
+    void decrease(void);
+    /// Drop least active no-goods exceeding the capacity
+    void shrink(void);
+    /// Destructor
+    ~StoredNoGoods(void);
+  };
+
+  /// Propagator for no-goods with two watched literals each
+  class GECODE_SEARCH_EXPORT WatchedNoGoodsProp : public Propagator {
+  public:
+    /// A no-good
+    class NoGood {
+    public:
+      /// The literals, the first two are watched
+      NGL** l;
+      /// Number of literals
+      int n;
+      /// Activity information
+      NoGoodActivity* a;
+    };
+  protected:
+    /// The no-goods
+    NoGood* ng;
+    /// Number of no-goods
+    int n;
+    /// Constructor for creation
+    WatchedNoGoodsProp(Space& home, NoGood* ng, int n);
+    /// Constructor for cloning \a p
+    WatchedNoGoodsProp(Space& home, WatchedNoGoodsProp& p);
+    /**
+     * \brief Propagate no-good \a g
+     *
+     * Sets \a s to whether the no-good is satisfied or has been
+     * dropped from the store.
+     */
+    ExecStatus watch(Space& home, NoGood& g, bool& s);
+    /// Cancel and dispose no-good \a g
+    void release(Space& home, NoGood& g);
+  public:
+    /// Perform copying during cloning
+    virtual Actor* copy(Space& home);
+    /// Const function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Post the \a n no-goods \a ng
+     *
+     * The no-goods as well as their literals must be allocated from
+     * \a home.
+     */
+    static ExecStatus post(Space& home, NoGood* ng, int n);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
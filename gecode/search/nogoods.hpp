@@ -171,6 +171,68 @@ namespace Gecode { namespace Search {
     return ES_OK;
   }
 
+  template<class Path>
+  forceinline void
+  NoGoodsProp::archive(const Path& p, Archive& e) {
+    int n = std::min(p.ds.entries(),static_cast<int>(p.ngdl()));
+    // Eliminate the alternatives which are not no-goods at the end
+    while ((n > 0) && (p.ds[n-1].truealt() == 0U))
+      n--;
+    e << n;
+    for (int i=0; i<n; i++) {
+      Archive c;
+      p.ds[i].choice()->archive(c);
+      e << p.ds[i].truealt() << c.size();
+      for (int j=0; j<c.size(); j++)
+        e << c[j];
+    }
+  }
+
+
+
+  forceinline
+  NoGoodActivity::NoGoodActivity(void)
+    : rc(1), hits(0), dropped(false) {}
+
+  forceinline void
+  NoGoodActivity::subscribe(void) {
+    rc.inc();
+  }
+
+  forceinline void
+  NoGoodActivity::cancel(void) {
+    if (rc.dec())
+      delete this;
+  }
+
+
+
+  forceinline
+  WatchedNoGoodsProp::WatchedNoGoodsProp(Space& home, NoGood* ng0, int n0)
+    : Propagator(Home(home)), ng(ng0), n(n0) {
+    for (int i=0; i<n; i++) {
+      ng[i].a->subscribe();
+      ng[i].l[0]->subscribe(home,*this);
+      ng[i].l[1]->subscribe(home,*this);
+    }
+    // The activities must always be released
+    home.notice(*this,AP_DISPOSE);
+  }
+
+  forceinline
+  WatchedNoGoodsProp::WatchedNoGoodsProp(Space& home, WatchedNoGoodsProp& p)
+    : Propagator(home,p), n(p.n) {
+    ng = home.alloc<NoGood>(n);
+    for (int i=0; i<n; i++) {
+      ng[i].n = p.ng[i].n;
+      ng[i].a = p.ng[i].a;
+      ng[i].a->subscribe();
+      ng[i].l = home.alloc<NGL*>(ng[i].n);
+      for (int j=0; j<ng[i].n; j++)
+        ng[i].l[j] = p.ng[i].l[j]->copy(home);
+    }
+  }
+
 }}
 
 // STATISTICS: search-other
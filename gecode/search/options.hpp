@@ -36,11 +36,15 @@ namespace Gecode { namespace Search {
   forceinline
   Options::Options(void)
     : clone(Config::clone),
-      threads(Config::threads),
-      c_d(Config::c_d), a_d(Config::a_d),
-      d_l(Config::d_l),
-      assets(0), slice(Config::slice), nogoods_limit(0),
-      stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
+      threads(Config::threads), numa(false), numa_nodes(0),
+      deterministic(false), d_split(Config::d_split), subproblems(0),
+      port(Config::port), address(Config::address),
+      c_d(Config::c_d), a_d(Config::a_d), batch(false), memory(0),
+      objective(false), instrument(false), d_l(Config::d_l),
+      assets(0), slice(Config::slice), adaptive(false), nogoods_limit(0),
+      nogoods_store(nullptr), independent(false),
+      stop(nullptr), cutoff(nullptr),
+      neighborhoods(nullptr), checkpoint(nullptr), tracer(nullptr) {}
 
 }}
 
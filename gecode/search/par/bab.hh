@@ -36,6 +36,8 @@
 
 #include <gecode/search/par/engine.hh>
 
+#include <limits>
+
 namespace Gecode { namespace Search { namespace Par {
 
   /// %Parallel branch-and-bound engine
@@ -58,6 +60,7 @@ namespace Gecode { namespace Search { namespace Par {
     using Engine<Tracer>::solutions;
     using Engine<Tracer>::terminate;
     using Engine<Tracer>::workers;
+    using Engine<Tracer>::numa;
     using Engine<Tracer>::C_WAIT;
     using Engine<Tracer>::C_RESET;
     using Engine<Tracer>::C_TERMINATE;
@@ -73,14 +76,29 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::idle;
       using Engine<Tracer>::Worker::node;
       using Engine<Tracer>::Worker::fail;
+      using Engine<Tracer>::Worker::steal_remote;
+      using Engine<Tracer>::Worker::t_recompute;
+      using Engine<Tracer>::Worker::t_steal;
+      using Engine<Tracer>::Worker::failure;
+      using Engine<Tracer>::Worker::stolen;
+      using Engine<Tracer>::Worker::status;
+      using Engine<Tracer>::Worker::copy;
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::rnd;
+      using Engine<Tracer>::Worker::spin;
+      using Engine<Tracer>::Worker::share;
+      using Engine<Tracer>::Worker::bind;
+      using Engine<Tracer>::Worker::unbind;
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Objective bound for current space and entries above mark
+      long long int ob;
     public:
+      using Engine<Tracer>::Worker::numa;
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, BAB& e);
       /// Provide access to engine
@@ -89,6 +107,8 @@ namespace Gecode { namespace Search { namespace Par {
       virtual void run(void);
       /// Accept better solution \a b
       void better(Space* b);
+      /// Accept better objective bound published by engine
+      void tighten(void);
       /// Try to find some work
       void find(void);
       /// Reset engine to restart at space \a s
@@ -98,11 +118,15 @@ namespace Gecode { namespace Search { namespace Par {
     };
     /// Array of worker references
     Worker** _worker;
-    /// Best solution so far
+    /// Best solution so far (if objective values are not used)
     Space* best;
+    /// Objective value of best solution so far (if used)
+    std::atomic<long long int> ob;
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
+    /// Return objective value of best solution so far
+    long long int bound(void) const;
 
     /// \name Search control
     //@{
@@ -46,6 +46,11 @@ namespace Gecode { namespace Search { namespace Par {
   BAB<Tracer>::worker(unsigned int i) const {
     return _worker[i];
   }
+  template<class Tracer>
+  forceinline long long int
+  BAB<Tracer>::bound(void) const {
+    return ob.load(std::memory_order_acquire);
+  }
 
   template<class Tracer>
   forceinline void
@@ -54,6 +59,7 @@ namespace Gecode { namespace Search { namespace Par {
     delete cur;
     delete best;
     best = NULL;
+    ob = std::numeric_limits<long long int>::max();
     path.reset((s == NULL) ? 0 : ngdl);
     d = 0;
     mark = 0;
@@ -74,12 +80,14 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   BAB<Tracer>::Worker::Worker(Space* s, BAB& e)
-    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL) {}
+    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL),
+      ob(std::numeric_limits<long long int>::max()) {}
 
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : Engine<Tracer>(o), best(NULL) {
+    : Engine<Tracer>(o), best(NULL),
+      ob(std::numeric_limits<long long int>::max()) {
     WrapTraceRecorder::engine(o.tracer, SearchTracer::EngineType::DFS,
                               workers());
     // Create workers
@@ -90,6 +98,8 @@ namespace Gecode { namespace Search { namespace Par {
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
       _worker[i] = new Worker(NULL,*this);
+    for (unsigned int i=0; i<workers(); i++)
+      _worker[i]->numa(numa(i));
     // Block all workers
     block();
     // Create and start threads
@@ -114,9 +124,32 @@ namespace Gecode { namespace Search { namespace Par {
   }
   template<class Tracer>
   forceinline void
+  BAB<Tracer>::Worker::tighten(void) {
+    long long int o = engine().bound();
+    if (o < ob) {
+      ob = o;
+      mark = path.entries();
+      if (cur != NULL)
+        cur->bound(ob);
+    }
+  }
+  template<class Tracer>
+  forceinline void
   BAB<Tracer>::solution(Space* s) {
     m_search.acquire();
-    if (best != NULL) {
+    long long int o;
+    if (opt().objective && s->objective(o)) {
+      /*
+       * Only the objective value is published: workers constrain by
+       * bound when they find it improved, no copies are needed.
+       */
+      if (o >= ob.load(std::memory_order_relaxed)) {
+        delete s;
+        m_search.release();
+        return;
+      }
+      ob.store(o,std::memory_order_release);
+    } else if (best != NULL) {
       s->constrain(*best);
       if (s->status() == SS_FAILED) {
         delete s;
@@ -130,8 +163,9 @@ namespace Gecode { namespace Search { namespace Par {
       best = s->clone();
     }
     // Announce better solutions
-    for (unsigned int i=0; i<workers(); i++)
-      worker(i)->better(best);
+    if (best != NULL)
+      for (unsigned int i=0; i<workers(); i++)
+        worker(i)->better(best);
     bool bs = signal();
     solutions.push(s);
     if (bs)
@@ -147,9 +181,15 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   BAB<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    // Start at a random worker to spread steal attempts among workers
+    unsigned int o = rnd(n);
+    // First try workers on the same NUMA node, then all others
+    for (unsigned int k=0; k<2*n; k++) {
+      typename Engine<Tracer>::Worker* wi = engine().worker((o+k) % n);
+      if ((wi == this) || ((wi->numa() == numa()) != (k < n)))
+        continue;
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
@@ -161,9 +201,14 @@ namespace Gecode { namespace Search { namespace Par {
         mark = 0;
         if (best != NULL)
           cur->constrain(*best);
+        else if (ob < std::numeric_limits<long long int>::max())
+          cur->bound(ob);
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        stolen((o+k) % n);
+        if (wi->numa() != numa())
+          steal_remote++;
         m.release();
         return;
       }
@@ -186,6 +231,13 @@ namespace Gecode { namespace Search { namespace Par {
   void
   BAB<Tracer>::constrain(const Space& b) {
     m_search.acquire();
+    long long int o;
+    if (opt().objective && b.objective(o)) {
+      if (o < ob.load(std::memory_order_relaxed))
+        ob.store(o,std::memory_order_release);
+      m_search.release();
+      return;
+    }
     if (best != NULL) {
       best->constrain(b);
       if (best->status() != SS_FAILED) {
@@ -226,6 +278,7 @@ namespace Gecode { namespace Search { namespace Par {
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
+    bind();
     // Okay, we are in business, start working
     while (true) {
       switch (engine().cmd()) {
@@ -238,6 +291,7 @@ namespace Gecode { namespace Search { namespace Par {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        unbind();
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
@@ -252,11 +306,21 @@ namespace Gecode { namespace Search { namespace Par {
         // Perform exploration work
         {
           m.acquire();
+          if (!idle)
+            tighten();
           if (idle) {
             m.release();
             // Try to find new work
-            find();
+            {
+              Measure mt(*this,t_steal);
+              find();
+            }
+            // Park if no work has been found for a while
+            if (idle)
+              spin();
           } else if (cur != NULL) {
+            // Wake up a parked worker if there is work to be stolen
+            share();
             start();
             if (stop(engine().opt())) {
               // Report stop
@@ -276,14 +340,14 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              switch (status(*cur)) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
                                             tracer.wid(), nid, *cur);
                   tracer.node(ei,ni);
                 }
-                fail++;
+                failure(static_cast<unsigned long int>(path.entries()));
                 delete cur;
                 cur = NULL;
                 path.next();
@@ -298,7 +362,7 @@ namespace Gecode { namespace Search { namespace Par {
                   }
                   // Deletes all pending branchers
                   (void) cur->choice();
-                  Space* s = cur->clone();
+                  Space* s = copy(*cur);
                   delete cur;
                   cur = NULL;
                   path.next();
@@ -310,7 +374,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = copy(*cur);
                     d = 1;
                   } else {
                     c = NULL;
@@ -331,7 +395,11 @@ namespace Gecode { namespace Search { namespace Par {
               }
             }
           } else if (!path.empty()) {
-            cur = path.recompute(d,engine().opt().a_d,*this,*best,mark,tracer);
+            {
+              Measure mt(*this,t_recompute);
+              cur = path.recompute(d,engine().opt().a_d,*this,
+                                   best,ob,mark,tracer);
+            }
             if (cur == NULL)
               path.next();
             m.release();
@@ -367,6 +435,7 @@ namespace Gecode { namespace Search { namespace Par {
     // All workers are marked as busy again
     delete best;
     best = NULL;
+    ob = std::numeric_limits<long long int>::max();
     n_busy = workers();
     for (unsigned int i=1; i<workers(); i++)
       worker(i)->reset(NULL,0);
@@ -0,0 +1,405 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/par/det.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/seq/dfs.hh>
+#include <gecode/search/seq/bab.hh>
+
+#include <algorithm>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /*
+   * Stop object
+   */
+  Det::DetStop::DetStop(Stop* so0, std::atomic<bool>& ts)
+    : so(so0), tostop(ts) {}
+
+  bool
+  Det::DetStop::stop(const Statistics& s, const Options& o) {
+    if (tostop.load(std::memory_order_relaxed))
+      return true;
+    if ((so != NULL) && so->stop(s,o)) {
+      tostop.store(true,std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+
+  /*
+   * Worker
+   */
+  Det::Worker::Worker(Det& d)
+    : det(d), next(NULL) {}
+
+  void
+  Det::Worker::run(void) {
+    det.m.acquire();
+    while (!det.terminate) {
+      int i = det.find();
+      if (i >= 0) {
+        det.sub[i].state = S_RUN;
+        det.n_run++;
+        det.m.release();
+        det.explore(static_cast<unsigned int>(i));
+        det.m.acquire();
+      } else {
+        next = det.idle; det.idle = this;
+        det.m.release();
+        e.wait();
+        det.m.acquire();
+      }
+    }
+    det.m.release();
+  }
+
+  Support::Terminator*
+  Det::Worker::terminator(void) const {
+    return &det;
+  }
+
+
+  /*
+   * Subproblems
+   */
+  void
+  Det::split(Support::DynamicArray<Space*,Heap>& r, unsigned int& n) {
+    for (unsigned int d=0; true; d++) {
+      // Remove failed subproblems
+      unsigned int k = 0;
+      for (unsigned int i=0; i<n; i++)
+        if (r[i]->status(base) == SS_FAILED) {
+          base.node++; base.failure(d);
+          delete r[i];
+        } else {
+          r[k++] = r[i];
+        }
+      n = k;
+      if (d == opt.d_split)
+        return;
+      // Split the subproblems of depth d as long as there are not too many
+      Support::DynamicArray<Space*,Heap> q(heap);
+      unsigned int m = 0;
+      bool split = false;
+      for (unsigned int i=0; i<n; i++) {
+        Space* s = r[i];
+        // Solutions and branching leaves are counted by their engines
+        if ((s->status(base) == SS_BRANCH) &&
+            (m+2+(n-i-1) <= Config::det_subproblems)) {
+          const Choice* c = s->choice();
+          unsigned int a = c->alternatives();
+          if (m+a+(n-i-1) <= Config::det_subproblems) {
+            base.node++;
+            base.depth = std::max(base.depth,
+                                  static_cast<unsigned long int>(d+1));
+            for (unsigned int j=0; j<a; j++) {
+              Space* t = (j+1 < a) ? s->clone() : s;
+              t->commit(*c,j);
+              q[m++] = t;
+            }
+            delete c;
+            split = true;
+            continue;
+          }
+          delete c;
+        }
+        q[m++] = s;
+      }
+      for (unsigned int i=0; i<m; i++)
+        r[i] = q[i];
+      n = m;
+      if (!split)
+        return;
+    }
+  }
+
+  void
+  Det::init(Space* s) {
+    Support::DynamicArray<Space*,Heap> r(heap);
+    unsigned int n = 0;
+    if ((s == NULL) || (s->status(base) == SS_FAILED)) {
+      base.failure(0);
+      if (!opt.clone)
+        delete s;
+    } else {
+      r[n++] = snapshot(s,opt);
+      split(r,n);
+    }
+    n_sub = n; head = 0;
+    sub = heap.alloc<Sub>(n_sub);
+    for (unsigned int i=0; i<n_sub; i++) {
+      sub[i].root = r[i];
+      sub[i].engine = NULL;
+      sub[i].sol = NULL;
+      sub[i].state = S_OPEN;
+    }
+    pb = heap.alloc<Space*>(n_sub+1);
+    for (unsigned int i=0; i<=n_sub; i++)
+      pb[i] = NULL;
+    stat = base;
+  }
+
+  void
+  Det::release(void) {
+    for (unsigned int i=0; i<n_sub; i++) {
+      delete sub[i].root;
+      delete sub[i].engine;
+      delete sub[i].sol;
+    }
+    heap.free<Sub>(sub,n_sub);
+    heap.free<Space*>(pb,n_sub+1);
+    sub = NULL; pb = NULL; n_sub = 0; head = 0;
+  }
+
+  void
+  Det::wake(void) {
+    while (idle != NULL) {
+      Worker* w = idle;
+      idle = w->next;
+      w->e.signal();
+    }
+  }
+
+  int
+  Det::find(void) const {
+    if (tostop.load(std::memory_order_relaxed))
+      return -1;
+    unsigned int l = std::min(n_sub,head+Config::det_window);
+    for (unsigned int i=head; i<l; i++)
+      if (sub[i].state == S_OPEN)
+        return static_cast<int>(i);
+    return -1;
+  }
+
+  bool
+  Det::better(const Space& s, const Space& b) {
+    Space* c = s.clone();
+    c->constrain(b);
+    bool r = (c->status() != SS_FAILED);
+    delete c;
+    return r;
+  }
+
+  void
+  Det::explore(unsigned int i) {
+    Sub& p = sub[i];
+    if (p.engine == NULL) {
+      if (best) {
+        p.engine = new WorkerToEngine<Seq::BAB<NoTraceRecorder>>(p.root,so);
+        p.root = NULL;
+        // Constrain by all subproblems at least a window before
+        m.acquire();
+        if ((i >= Config::det_window) && (pb[i-Config::det_window+1] != NULL))
+          p.engine->constrain(*pb[i-Config::det_window+1]);
+        if (bound != NULL)
+          p.engine->constrain(*bound);
+        m.release();
+      } else {
+        p.engine = new WorkerToEngine<Seq::DFS<NoTraceRecorder>>(p.root,so);
+        p.root = NULL;
+      }
+    }
+    if (best) {
+      while (Space* s = p.engine->next()) {
+        delete p.sol; p.sol = s;
+      }
+    } else {
+      p.sol = p.engine->next();
+    }
+    Statistics s = p.engine->statistics();
+    State ps;
+    if (!best && (p.sol != NULL)) {
+      ps = S_SOLVED;
+    } else if (p.engine->stopped()) {
+      ps = S_OPEN;
+    } else {
+      ps = S_DONE;
+      delete p.engine;
+      p.engine = NULL;
+    }
+    m.acquire();
+    p.stat = s;
+    p.state = ps;
+    n_run--;
+    m.release();
+    e_next.signal();
+  }
+
+  void
+  Det::quiescent(void) {
+    while (n_run > 0) {
+      m.release();
+      e_next.wait();
+      m.acquire();
+    }
+  }
+
+
+  /*
+   * Engine
+   */
+  Det::Det(Space* s, const Options& o, bool b)
+    : opt(o), so(o), best(b),
+      n_workers(static_cast<unsigned int>(o.threads)),
+      sub(NULL), n_sub(0), head(0), pb(NULL), bound(NULL),
+      n_run(0), idle(NULL), tostop(false), has_stopped(false),
+      terminate(false), n_not_terminated(n_workers), ds(o.stop,tostop) {
+    so.clone = false;
+    so.threads = 1.0;
+    so.numa = false;
+    so.stop = &ds;
+    so.tracer = NULL;
+    so.checkpoint = NULL;
+    base.histograms(opt.instrument);
+    init(s);
+    for (unsigned int i=0; i<n_workers; i++)
+      Support::Thread::run(new Worker(*this));
+  }
+
+  Space*
+  Det::next(void) {
+    m.acquire();
+    tostop.store(false,std::memory_order_relaxed);
+    has_stopped = false;
+    wake();
+    while (head < n_sub) {
+      Sub& p = sub[head];
+      if (p.state == S_SOLVED) {
+        // Solution of first subproblem, continue exploring it later
+        Space* s = p.sol;
+        p.sol = NULL;
+        p.state = S_OPEN;
+        stat = base; stat += p.stat;
+        wake();
+        m.release();
+        return s;
+      } else if (p.state == S_DONE) {
+        base += p.stat;
+        head++;
+        wake();
+        if (best) {
+          Space* b = pb[head-1];
+          if ((p.sol != NULL) &&
+              ((b == NULL) || better(*p.sol,*b)) &&
+              ((bound == NULL) || better(*p.sol,*bound))) {
+            pb[head] = p.sol;
+            stat = base;
+            Space* s = p.sol->clone();
+            m.release();
+            return s;
+          }
+          delete p.sol;
+          p.sol = NULL;
+          pb[head] = b;
+        }
+      } else if ((p.state == S_OPEN) &&
+                 tostop.load(std::memory_order_relaxed)) {
+        has_stopped = true;
+        stat = base;
+        m.release();
+        return NULL;
+      } else {
+        m.release();
+        e_next.wait();
+        m.acquire();
+      }
+    }
+    stat = base;
+    m.release();
+    return NULL;
+  }
+
+  Statistics
+  Det::statistics(void) const {
+    return stat;
+  }
+
+  bool
+  Det::stopped(void) const {
+    return has_stopped;
+  }
+
+  void
+  Det::constrain(const Space& b) {
+    if (!best)
+      Search::Engine::constrain(b);
+    m.acquire();
+    if ((bound == NULL) || better(b,*bound)) {
+      delete bound;
+      bound = b.clone();
+    }
+    m.release();
+  }
+
+  void
+  Det::reset(Space* s) {
+    m.acquire();
+    tostop.store(true,std::memory_order_relaxed);
+    quiescent();
+    release();
+    delete bound;
+    bound = NULL;
+    base.reset();
+    opt.clone = false;
+    init(s);
+    tostop.store(false,std::memory_order_relaxed);
+    has_stopped = false;
+    m.release();
+  }
+
+  void
+  Det::terminated(void) {
+    unsigned int n;
+    m.acquire();
+    n = --n_not_terminated;
+    m.release();
+    if (n == 0)
+      e_terminate.signal();
+  }
+
+  Det::~Det(void) {
+    m.acquire();
+    terminate = true;
+    tostop.store(true,std::memory_order_relaxed);
+    wake();
+    m.release();
+    e_terminate.wait();
+    release();
+    delete bound;
+  }
+
+}}}
+
+// STATISTICS: search-par
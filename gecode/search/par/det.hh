@@ -0,0 +1,193 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PAR_DET_HH__
+#define __GECODE_SEARCH_PAR_DET_HH__
+
+#include <gecode/search.hh>
+
+#include <atomic>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /**
+   * \brief Deterministic parallel engine
+   *
+   * The search tree is split sequentially level by level down to
+   * depth \a d_split into subproblems (in depth-first order), where a
+   * node is only split if the number of subproblems does not exceed
+   * Config::det_subproblems. The subproblems are
+   * explored by sequential engines run by the workers, at most
+   * Config::det_window subproblems ahead of the first subproblem
+   * that has not yet been finished. Solutions are reported in the
+   * order of the subproblems, so that solutions and statistics do
+   * not depend on the number of threads nor on their timing.
+   *
+   * For best solution search, a subproblem is constrained by the
+   * best solution of all subproblems that precede it by at least
+   * Config::det_window subproblems.
+   */
+  class Det : public Search::Engine, public Support::Terminator {
+  protected:
+    /// State of a subproblem
+    enum State {
+      S_OPEN,   ///< Subproblem can be explored
+      S_RUN,    ///< Subproblem is being explored by a worker
+      S_SOLVED, ///< Subproblem has a solution that has not been reported
+      S_DONE    ///< Subproblem has been explored completely
+    };
+    /// Subproblem
+    class Sub {
+    public:
+      /// Root of subproblem (until its engine is created)
+      Space* root;
+      /// Sequential engine for subproblem
+      Search::Engine* engine;
+      /// Solution (best solution for best solution search)
+      Space* sol;
+      /// Statistics of engine when it reported a solution or finished
+      Statistics stat;
+      /// State
+      State state;
+    };
+    /// Stop object for the engines of the subproblems
+    class DetStop : public Stop {
+    protected:
+      /// The stop object from the options
+      Stop* so;
+      /// Whether search must be stopped
+      std::atomic<bool>& tostop;
+    public:
+      /// Initialize
+      DetStop(Stop* so, std::atomic<bool>& ts);
+      /// Return true if search must be stopped
+      virtual bool stop(const Statistics& s, const Options& o);
+    };
+    /// Worker running the engines of subproblems
+    class Worker : public Support::Runnable {
+    public:
+      /// The engine
+      Det& det;
+      /// Event to wake up worker when idle
+      Support::Event e;
+      /// Next idle worker
+      Worker* next;
+      /// Initialize
+      Worker(Det& d);
+      /// Explore subproblems
+      virtual void run(void);
+      /// Return termination object
+      virtual Support::Terminator* terminator(void) const;
+    };
+    /// Search options
+    Options opt;
+    /// Options for the engines of subproblems
+    Options so;
+    /// Whether to search for best solutions
+    const bool best;
+    /// Number of workers
+    unsigned int n_workers;
+    /// Mutex for access to subproblems
+    Support::Mutex m;
+    /// Subproblems
+    Sub* sub;
+    /// Number of subproblems
+    unsigned int n_sub;
+    /// First subproblem that is not yet finished
+    unsigned int head;
+    /// Best solution of subproblems before a subproblem (best solution search)
+    Space** pb;
+    /// Bound from constrain (best solution search)
+    Space* bound;
+    /// Statistics of splitting and finished subproblems
+    Statistics base;
+    /// Statistics as of the last reported solution
+    Statistics stat;
+    /// Number of subproblems being explored
+    unsigned int n_run;
+    /// Idle workers
+    Worker* idle;
+    /// Event for change of a subproblem state
+    Support::Event e_next;
+    /// Whether search must be stopped
+    std::atomic<bool> tostop;
+    /// Whether search has been stopped
+    bool has_stopped;
+    /// Whether workers must terminate
+    bool terminate;
+    /// Number of workers not yet terminated
+    unsigned int n_not_terminated;
+    /// Event for termination of all workers
+    Support::Event e_terminate;
+    /// Stop object used by the engines of subproblems
+    DetStop ds;
+    /// Split the \a n subproblems \a r further
+    void split(Support::DynamicArray<Space*,Heap>& r, unsigned int& n);
+    /// Initialize subproblems for space \a s
+    void init(Space* s);
+    /// Delete all subproblems
+    void release(void);
+    /// Wake up all idle workers (requires mutex)
+    void wake(void);
+    /// Return next subproblem to be explored or -1 (requires mutex)
+    int find(void) const;
+    /// Explore subproblem \a i
+    void explore(unsigned int i);
+    /// Test whether solution \a s is better than \a b (requires mutex)
+    static bool better(const Space& s, const Space& b);
+    /// Wait until no subproblem is explored (requires mutex)
+    void quiescent(void);
+  public:
+    /// Initialize for space \a s with options \a o
+    Det(Space* s, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Reset engine to restart at space \a s
+    virtual void reset(Space* s);
+    /// Worker has terminated
+    virtual void terminated(void);
+    /// Destructor
+    virtual ~Det(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-par
@@ -58,6 +58,7 @@ namespace Gecode { namespace Search { namespace Par {
     using Engine<Tracer>::solutions;
     using Engine<Tracer>::terminate;
     using Engine<Tracer>::workers;
+    using Engine<Tracer>::numa;
     using Engine<Tracer>::C_WAIT;
     using Engine<Tracer>::C_RESET;
     using Engine<Tracer>::C_TERMINATE;
@@ -73,9 +74,22 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::idle;
       using Engine<Tracer>::Worker::node;
       using Engine<Tracer>::Worker::fail;
+      using Engine<Tracer>::Worker::steal_remote;
+      using Engine<Tracer>::Worker::t_recompute;
+      using Engine<Tracer>::Worker::t_steal;
+      using Engine<Tracer>::Worker::failure;
+      using Engine<Tracer>::Worker::stolen;
+      using Engine<Tracer>::Worker::status;
+      using Engine<Tracer>::Worker::copy;
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::rnd;
+      using Engine<Tracer>::Worker::spin;
+      using Engine<Tracer>::Worker::share;
+      using Engine<Tracer>::Worker::bind;
+      using Engine<Tracer>::Worker::unbind;
+      using Engine<Tracer>::Worker::numa;
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, DFS& e);
       /// Provide access to engine
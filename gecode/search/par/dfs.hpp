@@ -69,6 +69,8 @@ namespace Gecode { namespace Search { namespace Par {
     // All other workers start with no work
     for (unsigned int i=1; i<workers(); i++)
       _worker[i] = new Worker(NULL,*this);
+    for (unsigned int i=0; i<workers(); i++)
+      _worker[i]->numa(numa(i));
     // Block all workers
     block();
     // Create and start threads
@@ -121,9 +123,15 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   DFS<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    // Start at a random worker to spread steal attempts among workers
+    unsigned int o = rnd(n);
+    // First try workers on the same NUMA node, then all others
+    for (unsigned int k=0; k<2*n; k++) {
+      typename Engine<Tracer>::Worker* wi = engine().worker((o+k) % n);
+      if ((wi == this) || ((wi->numa() == numa()) != (k < n)))
+        continue;
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
@@ -135,6 +143,9 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        stolen((o+k) % n);
+        if (wi->numa() != numa())
+          steal_remote++;
         m.release();
         return;
       }
@@ -174,6 +185,7 @@ namespace Gecode { namespace Search { namespace Par {
     // Peform initial delay, if not first worker
     if (this != engine().worker(0))
       Support::Thread::sleep(Config::initial_delay);
+    bind();
     // Okay, we are in business, start working
     while (true) {
       switch (engine().cmd()) {
@@ -186,6 +198,7 @@ namespace Gecode { namespace Search { namespace Par {
         engine().ack_terminate();
         // Wait until termination can proceed
         engine().wait_terminate();
+        unbind();
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
@@ -203,8 +216,16 @@ namespace Gecode { namespace Search { namespace Par {
           if (idle) {
             m.release();
             // Try to find new work
-            find();
+            {
+              Measure mt(*this,t_steal);
+              find();
+            }
+            // Park if no work has been found for a while
+            if (idle)
+              spin();
           } else if (cur != NULL) {
+            // Wake up a parked worker if there is work to be stolen
+            share();
             start();
             if (stop(engine().opt())) {
               // Report stop
@@ -224,14 +245,14 @@ namespace Gecode { namespace Search { namespace Par {
                 }
               }
               unsigned int nid = tracer.nid();
-              switch (cur->status(*this)) {
+              switch (status(*cur)) {
               case SS_FAILED:
                 if (tracer) {
                   SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
                                             tracer.wid(), nid, *cur);
                   tracer.node(ei,ni);
                 }
-                fail++;
+                failure(static_cast<unsigned long int>(path.entries()));
                 delete cur;
                 cur = NULL;
                 path.next();
@@ -246,7 +267,7 @@ namespace Gecode { namespace Search { namespace Par {
                   }
                   // Deletes all pending branchers
                   (void) cur->choice();
-                  Space* s = cur->clone();
+                  Space* s = copy(*cur);
                   delete cur;
                   cur = NULL;
                   path.next();
@@ -258,7 +279,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = copy(*cur);
                     d = 1;
                   } else {
                     c = NULL;
@@ -279,7 +300,10 @@ namespace Gecode { namespace Search { namespace Par {
               }
             }
           } else if (!path.empty()) {
-            cur = path.recompute(d,engine().opt().a_d,*this,tracer);
+            {
+              Measure mt(*this,t_recompute);
+              cur = path.recompute(d,engine().opt().a_d,*this,tracer);
+            }
             if (cur == NULL)
               path.next();
             m.release();
@@ -39,6 +39,8 @@
 #include <gecode/search/worker.hh>
 #include <gecode/search/par/path.hh>
 
+#include <atomic>
+
 namespace Gecode { namespace Search { namespace Par {
 
   /// %Parallel depth-first search engine
@@ -47,6 +49,7 @@ namespace Gecode { namespace Search { namespace Par {
   protected:
     /// %Parallel depth-first search worker
     class Worker : public Search::Worker, public Support::Runnable {
+      friend class Engine;
     public:
       /// Search tracer
       Tracer tracer;
@@ -63,10 +66,43 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Random number generator for selecting workers to steal from
+      Support::RandomGenerator rnd;
+      /// NUMA node of worker
+      unsigned int _numa;
+      /// Number of unsuccessful attempts to find work since last parked
+      unsigned int n_spin;
+      /// Event to wake up worker when parked
+      Support::Event e_park;
+      /// Next parked worker
+      Worker* n_park;
+      /// Account for unsuccessful attempt to find work and possibly park
+      void spin(void);
+      /// Wake up a parked worker if this worker has work to be stolen
+      void share(void);
+      /// Bind thread to NUMA node of worker (if NUMA-aware)
+      void bind(void);
+      /// Release binding of thread (if NUMA-aware)
+      void unbind(void);
+      /// Perform propagation on \a s
+      SpaceStatus status(Space& s);
+      /// Return clone of \a s
+      Space* copy(const Space& s);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
-      /// Hand over some work (NULL if no work available)
+      /// Return NUMA node of worker
+      unsigned int numa(void) const;
+      /// %Set NUMA node of worker to \a n
+      void numa(unsigned int n);
+      /**
+       * \brief Hand over some work (NULL if no work available)
+       *
+       * Whether the worker has work is first checked without locking,
+       * only then the worker is locked to actually hand over work.
+       * Successful and failed attempts to hand over work (after
+       * locking) are recorded in the statistics of this worker.
+       */
       Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
       /// Return statistics
       Statistics statistics(void);
@@ -81,11 +117,15 @@ namespace Gecode { namespace Search { namespace Par {
     };
     /// Search options
     Options _opt;
+    /// Number of NUMA nodes used (one if not NUMA-aware)
+    unsigned int n_numa;
   public:
     /// Provide access to search options
     const Options& opt(void) const;
     /// Return number of workers
     unsigned int workers(void) const;
+    /// Return NUMA node for worker \a i
+    unsigned int numa(unsigned int i) const;
 
     /// \name Commands from engine to workers and wait management
     //@{
@@ -112,6 +152,24 @@ namespace Gecode { namespace Search { namespace Par {
     void wait(void);
     //@}
 
+    /// \name Parking of idle workers
+    //@{
+  protected:
+    /// Mutex for access to parked workers
+    Support::Mutex m_park;
+    /// List of parked workers
+    Worker* parked;
+    /// Number of parked workers
+    std::atomic<unsigned int> n_parked;
+  public:
+    /// Park worker \a w until woken up (only if engine asks for work)
+    void park(Worker& w);
+    /// Wake up a single parked worker (if any) as work is available
+    void unpark(void);
+    /// Wake up all parked workers as the command changes
+    void unpark_all(void);
+    //@}
+
     /// \name Termination control
     //@{
   protected:
@@ -53,6 +53,23 @@ namespace Gecode { namespace Search { namespace Par {
     return static_cast<unsigned int>(opt().threads);
   }
   template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::numa(unsigned int i) const {
+    // Consecutive workers share a node
+    return static_cast<unsigned int>((static_cast<unsigned long int>(i) *
+                                      n_numa) / workers());
+  }
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::numa(void) const {
+    return _numa;
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::numa(unsigned int n) {
+    _numa = n;
+  }
+  template<class Tracer>
   forceinline bool
   Engine<Tracer>::stopped(void) const {
     return has_stopped;
@@ -72,12 +89,14 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   Engine<Tracer>::block(void) {
     _cmd = C_WAIT;
+    unpark_all();
     _m_wait.acquire();
   }
   template<class Tracer>
   forceinline void
   Engine<Tracer>::release(Cmd c) {
     _cmd = c;
+    unpark_all();
     _m_wait.release();
   }
   template<class Tracer>
@@ -87,6 +106,97 @@ namespace Gecode { namespace Search { namespace Par {
   }
 
 
+  /*
+   * Engine: parking of idle workers
+   *
+   * A worker is only parked while the engine asks for work: every
+   * change of command wakes up all parked workers. As the command is
+   * changed before the mutex for parking is acquired, a worker either
+   * sees the new command and does not park or is woken up.
+   */
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::park(Worker& w) {
+    m_park.acquire();
+    if (_cmd != C_WORK) {
+      m_park.release();
+      return;
+    }
+    w.n_park = parked; parked = &w;
+    n_parked.fetch_add(1U,std::memory_order_relaxed);
+    m_park.release();
+    Measure mt(w,w.t_idle);
+    w.e_park.wait();
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::unpark(void) {
+    if (n_parked.load(std::memory_order_relaxed) == 0U)
+      return;
+    m_park.acquire();
+    if (parked != NULL) {
+      Worker* w = parked;
+      parked = w->n_park;
+      n_parked.fetch_sub(1U,std::memory_order_relaxed);
+      w->e_park.signal();
+    }
+    m_park.release();
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::unpark_all(void) {
+    m_park.acquire();
+    while (parked != NULL) {
+      Worker* w = parked;
+      parked = w->n_park;
+      w->e_park.signal();
+    }
+    n_parked.store(0U,std::memory_order_relaxed);
+    m_park.release();
+  }
+
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::spin(void) {
+    if (++n_spin > Config::idle_spin) {
+      n_spin = 0U;
+      engine().park(*this);
+    }
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::bind(void) {
+    if (engine().opt().numa)
+      (void) Support::Thread::numa_bind(_numa);
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::unbind(void) {
+    // Threads are pooled and must not keep the binding
+    if (engine().opt().numa)
+      Support::Thread::numa_unbind();
+  }
+  template<class Tracer>
+  forceinline SpaceStatus
+  Engine<Tracer>::Worker::status(Space& s) {
+    Measure mt(*this,t_propagate);
+    return s.status(*this);
+  }
+  template<class Tracer>
+  forceinline Space*
+  Engine<Tracer>::Worker::copy(const Space& s) {
+    Measure mt(*this,t_clone);
+    return s.clone();
+  }
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::share(void) {
+    n_spin = 0U;
+    if (path.steal())
+      engine().unpark();
+  }
+
+
   /*
    * Engine: initialization
    */
@@ -94,12 +204,14 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
-      path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      path(s == NULL ? 0 : e.opt().nogoods_limit,e.opt().batch), d(0),
+      idle(false), rnd(Support::hwrnd()), _numa(0U),
+      n_spin(0U), n_park(NULL) {
+    instrument(e.opt().instrument);
     tracer.worker();
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
-        fail++;
+        failure(0);
         cur = NULL;
         if (!engine().opt().clone)
           delete s;
@@ -114,7 +226,10 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   Engine<Tracer>::Engine(const Options& o)
-    : _opt(o), solutions(heap) {
+    : _opt(o), n_numa(1U), parked(NULL), n_parked(0U), solutions(heap) {
+    if (_opt.numa)
+      n_numa = std::min((_opt.numa_nodes > 0U) ? _opt.numa_nodes :
+                        Support::Thread::numa_nodes(),workers());
     // Initialize termination information
     _n_term_not_ack = workers();
     _n_not_terminated = workers();
@@ -274,6 +389,11 @@ namespace Gecode { namespace Search { namespace Par {
       return NULL;
     m.acquire();
     Space* s = path.steal(*this,d,myt,ot);
+    // Member function steal hides the statistics field
+    if (s != NULL)
+      Statistics::steal++;
+    else
+      Statistics::steal_fail++;
     m.release();
     // Tell that there will be one more busy worker
     if (s != NULL)
@@ -0,0 +1,298 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/par/eps.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/seq/dfs.hh>
+#include <gecode/search/seq/bab.hh>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /*
+   * Stop object
+   */
+  EPS::EPSStop::EPSStop(EPS& e, const unsigned long int& v)
+    : eps(e), version(v) {}
+
+  bool
+  EPS::EPSStop::stop(const Statistics& s, const Options& o) {
+    if (eps.tostop.load(std::memory_order_relaxed))
+      return true;
+    if ((eps.opt.stop != NULL) && eps.opt.stop->stop(s,o)) {
+      eps.ustop.store(true,std::memory_order_relaxed);
+      eps.tostop.store(true,std::memory_order_relaxed);
+      return true;
+    }
+    // Interrupt engine so that it can be constrained by a better solution
+    return eps.version.load(std::memory_order_relaxed) != version;
+  }
+
+
+  /*
+   * Jobs
+   */
+  EPS::Job::Job(EPS& e, Sub* s)
+    : eps(e), sub(s) {}
+
+  EPS::Result
+  EPS::Job::run(int) {
+    Result r;
+    r.sub = sub; r.sol = NULL; r.stopped = false;
+    if (sub->engine == NULL)
+      eps.engine(sub);
+    while (true) {
+      if (Space* s = sub->engine->next()) {
+        if (eps.report(s)) {
+          r.sol = s;
+          break;
+        }
+        delete s;
+      } else if (!sub->engine->stopped()) {
+        break;
+      } else if (eps.tostop.load(std::memory_order_relaxed)) {
+        r.stopped = true;
+        break;
+      } else {
+        // A better solution has been found by another job
+        eps.m.acquire();
+        sub->engine->constrain(*eps.b);
+        sub->version = eps.version.load(std::memory_order_relaxed);
+        eps.m.release();
+      }
+    }
+    r.stat = sub->engine->statistics();
+    return r;
+  }
+
+  EPS::Jobs::Jobs(EPS& e)
+    : eps(e) {}
+
+  bool
+  EPS::Jobs::operator ()(void) const {
+    eps.m.acquire();
+    bool j = !eps.tostop.load(std::memory_order_relaxed) && !eps.open.empty();
+    eps.m.release();
+    return j;
+  }
+
+  EPS::Job*
+  EPS::Jobs::job(void) {
+    eps.m.acquire();
+    Sub* s = eps.open.pop();
+    eps.m.release();
+    return new Job(eps,s);
+  }
+
+
+  /*
+   * Engine
+   */
+  void
+  EPS::decompose(Space* s, unsigned int n) {
+    Support::DynamicQueue<Space*,Heap> q(heap);
+    unsigned int n_q = 0;
+    if ((s == NULL) || (s->status(base) == SS_FAILED)) {
+      base.failure(0);
+      if (!opt.clone)
+        delete s;
+    } else {
+      q.push(snapshot(s,opt)); n_q++;
+    }
+    // Expand the tree level by level until there are enough subproblems
+    bool branched = true;
+    unsigned long int d = 0;
+    while (branched && (n_q < n)) {
+      branched = false;
+      d++;
+      for (unsigned int i=n_q; i--; ) {
+        Space* c = q.pop(); n_q--;
+        if (c->status(base) == SS_SOLVED) {
+          q.push(c); n_q++;
+          continue;
+        }
+        branched = true;
+        base.node++;
+        const Choice* ch = c->choice();
+        unsigned int a = ch->alternatives();
+        for (unsigned int j=0; j<a; j++) {
+          Space* t = (j+1 < a) ? c->clone() : c;
+          t->commit(*ch,j);
+          if (t->status(base) == SS_FAILED) {
+            base.node++; base.failure(d);
+            delete t;
+          } else {
+            q.push(t); n_q++;
+          }
+        }
+        delete ch;
+      }
+    }
+    n_sub = n_q;
+    sub = heap.alloc<Sub>(n_sub);
+    for (unsigned int i=0; i<n_sub; i++) {
+      sub[i].root = q.pop();
+      sub[i].engine = NULL;
+      sub[i].stop = NULL;
+      sub[i].version = 0;
+      open.push(&sub[i]);
+    }
+  }
+
+  void
+  EPS::engine(Sub* s) {
+    s->stop = new EPSStop(*this,s->version);
+    Options so(opt);
+    so.clone = false;
+    so.threads = 1.0;
+    so.numa = false;
+    so.stop = s->stop;
+    so.tracer = NULL;
+    so.checkpoint = NULL;
+    if (best) {
+      s->engine = new WorkerToEngine<Seq::BAB<NoTraceRecorder>>(s->root,so);
+      m.acquire();
+      if (b != NULL)
+        s->engine->constrain(*b);
+      s->version = version.load(std::memory_order_relaxed);
+      m.release();
+    } else {
+      s->engine = new WorkerToEngine<Seq::DFS<NoTraceRecorder>>(s->root,so);
+    }
+    s->root = NULL;
+  }
+
+  bool
+  EPS::better(const Space& s, const Space& b) {
+    Space* c = s.clone();
+    c->constrain(b);
+    bool r = (c->status() != SS_FAILED);
+    delete c;
+    return r;
+  }
+
+  bool
+  EPS::report(Space* s) {
+    m.acquire();
+    if (best) {
+      if ((b != NULL) && !better(*s,*b)) {
+        m.release();
+        return false;
+      }
+      delete b;
+      b = s->clone();
+      version.fetch_add(1,std::memory_order_relaxed);
+    }
+    sols.push(s);
+    tostop.store(true,std::memory_order_relaxed);
+    m.release();
+    return true;
+  }
+
+  EPS::EPS(Space* s, const Options& o, bool b0)
+    : opt(o), best(b0), open(heap), sols(heap), sub(NULL), n_sub(0),
+      b(NULL), version(0), tostop(false), ustop(false),
+      has_stopped(false), jobs(*this) {
+    base.histograms(opt.instrument);
+    unsigned int n = opt.subproblems;
+    if (n == 0)
+      n = Config::subproblems * static_cast<unsigned int>(opt.threads);
+    decompose(s,n);
+  }
+
+  Space*
+  EPS::next(void) {
+    has_stopped = false;
+    if (sols.empty() && !open.empty()) {
+      tostop.store(false,std::memory_order_relaxed);
+      ustop.store(false,std::memory_order_relaxed);
+      // Run jobs until a solution is found or all jobs are stopped
+      Support::RunJobs<Jobs,Result>
+        run(jobs,static_cast<unsigned int>(opt.threads));
+      Result r;
+      while (run.run(r)) {
+        r.sub->stat = r.stat;
+        if ((r.sol != NULL) || r.stopped) {
+          m.acquire();
+          open.push(r.sub);
+          m.release();
+        } else {
+          delete r.sub->engine;
+          r.sub->engine = NULL;
+        }
+      }
+    }
+    if (!sols.empty())
+      return sols.pop();
+    has_stopped = ustop.load(std::memory_order_relaxed);
+    return NULL;
+  }
+
+  Statistics
+  EPS::statistics(void) const {
+    Statistics s(base);
+    for (unsigned int i=0; i<n_sub; i++)
+      s += sub[i].stat;
+    return s;
+  }
+
+  bool
+  EPS::stopped(void) const {
+    return has_stopped;
+  }
+
+  void
+  EPS::constrain(const Space& b0) {
+    if (!best)
+      Search::Engine::constrain(b0);
+    if ((b == NULL) || better(b0,*b)) {
+      delete b;
+      b = b0.clone();
+      version.fetch_add(1,std::memory_order_relaxed);
+    }
+  }
+
+  EPS::~EPS(void) {
+    for (unsigned int i=0; i<n_sub; i++) {
+      delete sub[i].root;
+      delete sub[i].engine;
+      delete sub[i].stop;
+    }
+    heap.free<Sub>(sub,n_sub);
+    while (!sols.empty())
+      delete sols.pop();
+    delete b;
+  }
+
+}}}
+
+// STATISTICS: search-par
@@ -0,0 +1,177 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PAR_EPS_HH__
+#define __GECODE_SEARCH_PAR_EPS_HH__
+
+#include <gecode/search.hh>
+
+#include <atomic>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /**
+   * \brief Embarrassingly parallel search engine
+   *
+   * The root is decomposed breadth-first into at least \a subproblems
+   * consistent subproblems (if the tree is large enough). The
+   * subproblems are kept in a queue and are explored as jobs by
+   * sequential engines run by Support::RunJobs.
+   *
+   * For best solution search, the best solution found so far is shared
+   * between all jobs: whenever it improves, running jobs are
+   * interrupted by their stop object and constrained by it.
+   */
+  class EPS : public Search::Engine {
+  protected:
+    /// Subproblem
+    class Sub {
+    public:
+      /// Root of subproblem (until its engine is created)
+      Space* root;
+      /// Sequential engine for subproblem
+      Search::Engine* engine;
+      /// Stop object for engine
+      Stop* stop;
+      /// Version of best solution the engine is constrained by
+      unsigned long int version;
+      /// Statistics of engine when its job returned
+      Statistics stat;
+    };
+    /// Result of running a job
+    class Result {
+    public:
+      /// The subproblem
+      Sub* sub;
+      /// Solution found (NULL if none)
+      Space* sol;
+      /// Whether the job has been stopped
+      bool stopped;
+      /// Statistics of the engine of the subproblem
+      Statistics stat;
+    };
+    /// Stop object for the engines of the subproblems
+    class EPSStop : public Stop {
+    protected:
+      /// The engine
+      EPS& eps;
+      /// The version of the best solution of the subproblem's engine
+      const unsigned long int& version;
+    public:
+      /// Initialize
+      EPSStop(EPS& e, const unsigned long int& v);
+      /// Return true if search must be stopped or the bound changed
+      virtual bool stop(const Statistics& s, const Options& o);
+    };
+    /// Job exploring a subproblem
+    class Job : public Support::Job<Result> {
+    protected:
+      /// The engine
+      EPS& eps;
+      /// The subproblem
+      Sub* sub;
+    public:
+      /// Initialize
+      Job(EPS& e, Sub* s);
+      /// Explore subproblem until it finds a solution or is exhausted
+      virtual Result run(int i);
+    };
+    /// Iterator over jobs for open subproblems
+    class Jobs {
+    protected:
+      /// The engine
+      EPS& eps;
+    public:
+      /// Initialize
+      Jobs(EPS& e);
+      /// Test whether there are more jobs
+      bool operator ()(void) const;
+      /// Return next job
+      Job* job(void);
+    };
+    /// Search options
+    Options opt;
+    /// Whether to search for best solutions
+    const bool best;
+    /// Mutex for access to the queue and the best solution
+    Support::Mutex m;
+    /// Open subproblems
+    Support::DynamicQueue<Sub*,Heap> open;
+    /// Solutions not yet reported
+    Support::DynamicQueue<Space*,Heap> sols;
+    /// All subproblems
+    Sub* sub;
+    /// Number of subproblems
+    unsigned int n_sub;
+    /// Best solution found so far (best solution search)
+    Space* b;
+    /// Version of best solution (incremented when it improves)
+    std::atomic<unsigned long int> version;
+    /// Whether search must be stopped
+    std::atomic<bool> tostop;
+    /// Whether search has been stopped by the stop object from the options
+    std::atomic<bool> ustop;
+    /// Whether search has been stopped
+    bool has_stopped;
+    /// Statistics of decomposition
+    Statistics base;
+    /// Iterator over jobs
+    Jobs jobs;
+    /// Decompose \a s into at least \a n subproblems
+    void decompose(Space* s, unsigned int n);
+    /// Create engine for subproblem \a s
+    void engine(Sub* s);
+    /// Report solution \a s and return whether it has been accepted
+    bool report(Space* s);
+    /// Test whether solution \a s is better than \a b (requires mutex)
+    static bool better(const Space& s, const Space& b);
+  public:
+    /// Initialize for space \a s with options \a o
+    EPS(Space* s, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~EPS(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-par
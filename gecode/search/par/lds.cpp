@@ -0,0 +1,272 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/par/lds.hh>
+#include <gecode/search/support.hh>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /*
+   * Stop object
+   */
+  LDS::LDSStop::LDSStop(LDS& e)
+    : lds(e) {}
+
+  bool
+  LDS::LDSStop::stop(const Statistics& s, const Options& o) {
+    if (lds.tostop.load(std::memory_order_relaxed))
+      return true;
+    if ((lds.opt.stop != NULL) && lds.opt.stop->stop(s,o)) {
+      lds.ustop.store(true,std::memory_order_relaxed);
+      lds.tostop.store(true,std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+
+  /*
+   * Jobs
+   */
+  LDS::Job::Job(LDS& e, Sub* s)
+    : lds(e), sub(s) {}
+
+  LDS::Result
+  LDS::Job::run(int) {
+    Result r;
+    r.sub = sub; r.sol = NULL; r.stopped = false;
+    if (sub->probe == NULL) {
+      sub->probe = new Probe(lds.so);
+      sub->probe->init(NULL);
+    }
+    if (!sub->running) {
+      sub->probe->reset(sub->root->clone(),lds.d - sub->c);
+      sub->running = true;
+    }
+    if (Space* s = sub->probe->next(lds.so)) {
+      lds.report(s);
+      r.sol = s;
+    } else if (sub->probe->stopped()) {
+      r.stopped = true;
+    } else {
+      // The probe is done
+      sub->stat += sub->probe->statistics();
+      sub->exhausted = sub->probe->done();
+      sub->probe->reset(NULL,0);
+      sub->running = false;
+    }
+    return r;
+  }
+
+  LDS::Jobs::Jobs(LDS& e)
+    : lds(e) {}
+
+  bool
+  LDS::Jobs::operator ()(void) const {
+    lds.m.acquire();
+    bool j = !lds.tostop.load(std::memory_order_relaxed) && !lds.open.empty();
+    lds.m.release();
+    return j;
+  }
+
+  LDS::Job*
+  LDS::Jobs::job(void) {
+    lds.m.acquire();
+    Sub* s = lds.open.pop();
+    lds.m.release();
+    return new Job(lds,s);
+  }
+
+
+  /*
+   * Engine
+   */
+  void
+  LDS::decompose(Space* s, unsigned int n) {
+    Support::DynamicQueue<Space*,Heap> q(heap);
+    Support::DynamicQueue<unsigned int,Heap> qc(heap);
+    unsigned int n_q = 0;
+    base.node++;
+    if ((s == NULL) || (s->status(base) == SS_FAILED)) {
+      base.failure(0);
+      if (!opt.clone)
+        delete s;
+    } else {
+      q.push(snapshot(s,opt)); qc.push(0U); n_q++;
+    }
+    // Expand the tree level by level until there are enough subproblems
+    bool branched = true;
+    unsigned long int d = 0;
+    while (branched && (n_q < n)) {
+      branched = false;
+      d++;
+      for (unsigned int i=n_q; i--; ) {
+        Space* c = q.pop(); unsigned int cc = qc.pop(); n_q--;
+        if (c->status(base) == SS_SOLVED) {
+          q.push(c); qc.push(cc); n_q++;
+          continue;
+        }
+        branched = true;
+        const Choice* ch = c->choice();
+        // Alternatives exceeding the discrepancy limit are never explored
+        unsigned int a = std::min(ch->alternatives(),opt.d_l - cc + 1U);
+        for (unsigned int j=0; j<a; j++) {
+          Space* t = (j+1 < a) ? c->clone() : c;
+          t->commit(*ch,j);
+          base.node++;
+          if (t->status(base) == SS_FAILED) {
+            base.failure(d);
+            delete t;
+          } else {
+            q.push(t); qc.push(cc+j); n_q++;
+          }
+        }
+        delete ch;
+      }
+    }
+    n_sub = n_q;
+    sub = heap.alloc<Sub>(n_sub);
+    for (unsigned int i=0; i<n_sub; i++) {
+      sub[i].root = q.pop();
+      sub[i].c = qc.pop();
+      sub[i].probe = NULL;
+      sub[i].running = false;
+      sub[i].exhausted = false;
+    }
+  }
+
+  bool
+  LDS::probe(void) {
+    bool left = false;
+    for (unsigned int i=0; i<n_sub; i++)
+      if (!sub[i].exhausted) {
+        left = true;
+        if (sub[i].c <= d)
+          open.push(&sub[i]);
+      }
+    started = true;
+    return left;
+  }
+
+  void
+  LDS::report(Space* s) {
+    m.acquire();
+    sols.push(s);
+    tostop.store(true,std::memory_order_relaxed);
+    m.release();
+  }
+
+  LDS::LDS(Space* s, const Options& o)
+    : opt(o), so(o), ls(*this), open(heap), sols(heap), sub(NULL),
+      n_sub(0), d(0), started(false), tostop(false), ustop(false),
+      has_stopped(false), jobs(*this) {
+    so.clone = false;
+    so.threads = 1.0;
+    so.numa = false;
+    so.stop = &ls;
+    so.tracer = NULL;
+    so.checkpoint = NULL;
+    base.histograms(opt.instrument);
+    unsigned int n = opt.subproblems;
+    if (n == 0)
+      n = Config::subproblems * static_cast<unsigned int>(opt.threads);
+    decompose(s,n);
+  }
+
+  Space*
+  LDS::next(void) {
+    has_stopped = false;
+    while (sols.empty()) {
+      if (open.empty()) {
+        // All probes for the current discrepancy are done
+        if (started) {
+          if (d >= opt.d_l)
+            break;
+          d++;
+        }
+        if (!probe())
+          break;
+        continue;
+      }
+      tostop.store(false,std::memory_order_relaxed);
+      ustop.store(false,std::memory_order_relaxed);
+      // Run probes until a solution is found or all probes are stopped
+      Support::RunJobs<Jobs,Result>
+        run(jobs,static_cast<unsigned int>(opt.threads));
+      Result r;
+      while (run.run(r))
+        if ((r.sol != NULL) || r.stopped) {
+          m.acquire();
+          open.push(r.sub);
+          m.release();
+        }
+      if (sols.empty() && ustop.load(std::memory_order_relaxed)) {
+        has_stopped = true;
+        break;
+      }
+    }
+    if (!sols.empty())
+      return sols.pop();
+    return NULL;
+  }
+
+  Statistics
+  LDS::statistics(void) const {
+    Statistics s(base);
+    for (unsigned int i=0; i<n_sub; i++) {
+      s += sub[i].stat;
+      if (sub[i].probe != NULL)
+        s += sub[i].probe->statistics();
+    }
+    return s;
+  }
+
+  bool
+  LDS::stopped(void) const {
+    return has_stopped;
+  }
+
+  LDS::~LDS(void) {
+    for (unsigned int i=0; i<n_sub; i++) {
+      delete sub[i].root;
+      delete sub[i].probe;
+    }
+    heap.free<Sub>(sub,n_sub);
+    while (!sols.empty())
+      delete sols.pop();
+  }
+
+}}}
+
+// STATISTICS: search-par
@@ -0,0 +1,181 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_PAR_LDS_HH__
+#define __GECODE_SEARCH_PAR_LDS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/seq/lds.hh>
+
+#include <atomic>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /**
+   * \brief Parallel limited discrepancy search engine
+   *
+   * The root is decomposed breadth-first into subproblems (as for
+   * embarrassingly parallel search), each subproblem remembers the
+   * number of discrepancies taken to reach it. For each discrepancy
+   * \f$d\f$ up to the discrepancy limit, a probe with \f$d-c\f$
+   * discrepancies is run as a job for every subproblem reached with
+   * \f$c\le d\f$ discrepancies. The probes for \f$d\f$ are finished
+   * before the probes for \f$d+1\f$ start, hence solutions are found
+   * in the same order of discrepancies as by sequential limited
+   * discrepancy search.
+   *
+   * A subproblem for which a probe has explored its entire tree is not
+   * probed again. The statistics are accumulated over all probes.
+   */
+  class LDS : public Search::Engine {
+  protected:
+    /// Probe engine
+    typedef Seq::Probe<NoTraceRecorder> Probe;
+    /// Subproblem
+    class Sub {
+    public:
+      /// Root of subproblem
+      Space* root;
+      /// Number of discrepancies taken to reach the subproblem
+      unsigned int c;
+      /// Probe for subproblem
+      Probe* probe;
+      /// Whether the probe for the current discrepancy has been started
+      bool running;
+      /// Whether the entire tree of the subproblem has been explored
+      bool exhausted;
+      /// Statistics of finished probes
+      Statistics stat;
+    };
+    /// Result of running a job
+    class Result {
+    public:
+      /// The subproblem
+      Sub* sub;
+      /// Solution found (NULL if none)
+      Space* sol;
+      /// Whether the job has been stopped
+      bool stopped;
+    };
+    /// Stop object for the probes
+    class LDSStop : public Stop {
+    protected:
+      /// The engine
+      LDS& lds;
+    public:
+      /// Initialize
+      LDSStop(LDS& e);
+      /// Return true if search must be stopped
+      virtual bool stop(const Statistics& s, const Options& o);
+    };
+    /// Job running a probe for a subproblem
+    class Job : public Support::Job<Result> {
+    protected:
+      /// The engine
+      LDS& lds;
+      /// The subproblem
+      Sub* sub;
+    public:
+      /// Initialize
+      Job(LDS& e, Sub* s);
+      /// Probe subproblem until a solution is found or the probe is done
+      virtual Result run(int i);
+    };
+    /// Iterator over jobs for open subproblems
+    class Jobs {
+    protected:
+      /// The engine
+      LDS& lds;
+    public:
+      /// Initialize
+      Jobs(LDS& e);
+      /// Test whether there are more jobs
+      bool operator ()(void) const;
+      /// Return next job
+      Job* job(void);
+    };
+    /// Search options
+    Options opt;
+    /// Options for the probes
+    Options so;
+    /// Stop object for the probes
+    LDSStop ls;
+    /// Mutex for access to the queue and the solutions
+    Support::Mutex m;
+    /// Subproblems still to be probed for the current discrepancy
+    Support::DynamicQueue<Sub*,Heap> open;
+    /// Solutions not yet reported
+    Support::DynamicQueue<Space*,Heap> sols;
+    /// All subproblems
+    Sub* sub;
+    /// Number of subproblems
+    unsigned int n_sub;
+    /// Current discrepancy
+    unsigned int d;
+    /// Whether probes for the current discrepancy have been queued
+    bool started;
+    /// Whether search must be stopped
+    std::atomic<bool> tostop;
+    /// Whether search has been stopped by the stop object from the options
+    std::atomic<bool> ustop;
+    /// Whether search has been stopped
+    bool has_stopped;
+    /// Statistics of decomposition
+    Statistics base;
+    /// Iterator over jobs
+    Jobs jobs;
+    /// Decompose \a s into at least \a n subproblems
+    void decompose(Space* s, unsigned int n);
+    /// Queue probes for the current discrepancy, return false if no subproblem is left
+    bool probe(void);
+    /// Report solution \a s
+    void report(Space* s);
+  public:
+    /// Initialize for space \a s with options \a o
+    LDS(Space* s, const Options& o);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~LDS(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-par
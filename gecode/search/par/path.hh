@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_PAR_PATH_HH__
 
 #include <algorithm>
+#include <atomic>
 
 #include <gecode/search.hh>
 #include <gecode/search/support.hh>
@@ -115,11 +116,19 @@ namespace Gecode { namespace Search { namespace Par {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
-    /// Number of edges that have work for stealing
-    unsigned int n_work;
+    /**
+     * \brief Number of edges that have work for stealing
+     *
+     * Only modified by the worker owning the path while holding its
+     * mutex, but read by other workers without locking to quickly check
+     * whether stealing might be feasible.
+     */
+    std::atomic<unsigned int> n_work;
+    /// Whether to use strict batch recomputation
+    bool _batch;
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l and whether to use strict batch recomputation \a bt
+    Path(unsigned int l, bool bt=false);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
@@ -141,9 +150,11 @@ namespace Gecode { namespace Search { namespace Par {
     /// Recompute space according to path
     Space* recompute(unsigned int& d, unsigned int a_d, Worker& s,
                      Tracer& t);
+    /// Constrain \a s by \a best or, if \a best is NULL, by bound \a o
+    static void constrain(Space* s, const Space* best, long long int o);
     /// Recompute space according to path
     Space* recompute(unsigned int& d, unsigned int a_d, Worker& s,
-                     const Space& best, int& mark,
+                     const Space* best, long long int o, int& mark,
                      Tracer& t);
     /// Return number of entries on stack
     int entries(void) const;
@@ -156,6 +167,8 @@ namespace Gecode { namespace Search { namespace Par {
                  Tracer& myt, Tracer& ot);
     /// Post no-goods
     void virtual post(Space& home) const;
+    /// Archive no-goods
+    virtual void archive(Archive& e) const;
   };
 
 }}}
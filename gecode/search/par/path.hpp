@@ -125,8 +125,8 @@ namespace Gecode { namespace Search { namespace Par {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l), n_work(0) {}
+  Path<Tracer>::Path(unsigned int l, bool bt)
+    : ds(heap), _ngdl(l), n_work(0), _batch(bt) {}
 
   template<class Tracer>
   forceinline unsigned int
@@ -149,7 +149,7 @@ namespace Gecode { namespace Search { namespace Par {
     }
     Edge sn(s,c,nid);
     if (sn.work())
-      n_work++;
+      n_work.fetch_add(1U,std::memory_order_relaxed);
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
     return sn.choice();
@@ -165,7 +165,7 @@ namespace Gecode { namespace Search { namespace Par {
         assert(ds.top().work());
         ds.top().next();
         if (!ds.top().work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         return;
       }
   }
@@ -219,13 +219,13 @@ namespace Gecode { namespace Search { namespace Par {
           t.skip(ei);
         }
         if (ds.top().work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         ds.pop().dispose();
       }
     } else {
       for (int i=l; i<n; i++) {
         if (ds.top().work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         ds.pop().dispose();
       }
     }
@@ -235,7 +235,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline void
   Path<Tracer>::reset(unsigned int l) {
-    n_work = 0;
+    n_work.store(0U,std::memory_order_relaxed);
     while (!ds.empty())
       ds.pop().dispose();
     _ngdl = l;
@@ -244,7 +244,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline bool
   Path<Tracer>::steal(void) const {
-    return n_work > Config::steal_limit;
+    return n_work.load(std::memory_order_relaxed) > Config::steal_limit;
   }
 
   template<class Tracer>
@@ -270,7 +270,7 @@ namespace Gecode { namespace Search { namespace Par {
         unsigned int a = ds[n].steal();
         c->commit(*ds[n].choice(),a);
         if (!ds[n].work())
-          n_work--;
+          n_work.fetch_sub(1U,std::memory_order_relaxed);
         // No no-goods can be extracted above n
         ngdl(std::min(ngdl(),static_cast<unsigned int>(n)));
         d = stat.steal_depth(static_cast<unsigned long int>(n+1));
@@ -312,7 +312,7 @@ namespace Gecode { namespace Search { namespace Par {
 
     Space* s = ds[l].space()->clone(); // Last clone
 
-    if (d < a_d) {
+    if (_batch || (d < a_d)) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
         commit(s,i);
@@ -336,7 +336,7 @@ namespace Gecode { namespace Search { namespace Par {
         if (ss == SS_FAILED) {
           // s must be deleted as it is not on the stack
           delete s;
-          stat.fail++;
+          stat.failure(static_cast<unsigned long int>(i));
           unwind(i,t);
           return NULL;
         }
@@ -350,10 +350,19 @@ namespace Gecode { namespace Search { namespace Par {
     return s;
   }
 
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::constrain(Space* s, const Space* best, long long int o) {
+    if (best != NULL)
+      s->constrain(*best);
+    else
+      s->bound(o);
+  }
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::recompute(unsigned int& d, unsigned int a_d, Worker& stat,
-                          const Space& best, int& mark,
+                          const Space* best, long long int o, int& mark,
                           Tracer& t) {
     assert(!ds.empty());
     // Recompute space according to path
@@ -366,7 +375,7 @@ namespace Gecode { namespace Search { namespace Par {
       assert(ds.entries()-1 == lc());
       if (mark > ds.entries()-1) {
         mark = ds.entries()-1;
-        s->constrain(best);
+        constrain(s,best,o);
       }
       ds.top().space(NULL);
       // Mark as reusable
@@ -383,14 +392,20 @@ namespace Gecode { namespace Search { namespace Par {
 
     Space* s = ds[l].space(); // Last clone
 
-    if (l < mark) {
+    if (_batch) {
+      // Only the recomputed space is constrained, the clone on the
+      // stack stays as is and is constrained again when reused
+      s = s->clone();
+      if (l < mark)
+        constrain(s,best,o);
+    } else if (l < mark) {
       mark = l;
-      s->constrain(best);
+      constrain(s,best,o);
       // The space on the stack could be failed now as an additional
       // constraint might have been added.
       if (s->status(stat) == SS_FAILED) {
         // s does not need deletion as it is on the stack (unwind does this)
-        stat.fail++;
+        stat.failure(static_cast<unsigned long int>(l));
         unwind(l,t);
         return NULL;
       }
@@ -403,7 +418,7 @@ namespace Gecode { namespace Search { namespace Par {
       s = s->clone();
     }
 
-    if (d < a_d) {
+    if (_batch || (d < a_d)) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
         commit(s,i);
@@ -430,7 +445,7 @@ namespace Gecode { namespace Search { namespace Par {
         if (ss == SS_FAILED) {
           // s must be deleted as it is not on the stack
           delete s;
-          stat.fail++;
+          stat.failure(static_cast<unsigned long int>(i));
           unwind(i,t);
           return NULL;
         }
@@ -450,6 +465,12 @@ namespace Gecode { namespace Search { namespace Par {
     GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::archive(Archive& e) const {
+    NoGoodsProp::archive(*this,e);
+  }
+
 }}}
 
 // STATISTICS: search-par
@@ -73,8 +73,10 @@ namespace Gecode { namespace Search { namespace Par {
     /// Stop object
     Stop* stop;
   public:
-    /// Initialize with master \a m, slave \a s, and its stop object \a so
-    Slave(PBS<Collect>* m, Engine* s, Stop* so);
+    /// Position of the asset in the portfolio
+    const unsigned int i;
+    /// Initialize with master \a m, slave \a s, its stop object \a so, and position \a i
+    Slave(PBS<Collect>* m, Engine* s, Stop* so, unsigned int i);
     /// Return statistics of slave
     Statistics statistics(void) const;
     /// Check whether slave has been stopped
@@ -179,6 +181,10 @@ namespace Gecode { namespace Search { namespace Par {
     virtual bool stopped(void) const;
     /// Constrain future solutions to be better than \a b
     virtual void constrain(const Space& b);
+    /// Return number of assets
+    virtual unsigned int assets(void) const;
+    /// Return statistics of asset \a a
+    virtual Statistics asset(unsigned int a) const;
     /// Destructor
     virtual ~PBS(void);
   };
@@ -125,8 +125,9 @@ namespace Gecode { namespace Search { namespace Par {
 
   template<class Collect>
   forceinline
-  Slave<Collect>::Slave(PBS<Collect>* m, Engine* s, Stop* so)
-    : Support::Runnable(false), master(m), slave(s), stop(so) {}
+  Slave<Collect>::Slave(PBS<Collect>* m, Engine* s, Stop* so,
+                        unsigned int i0)
+    : Support::Runnable(false), master(m), slave(s), stop(so), i(i0) {}
   template<class Collect>
   forceinline Statistics
   Slave<Collect>::statistics(void) const {
@@ -159,7 +160,7 @@ namespace Gecode { namespace Search { namespace Par {
       slave_stop(false), tostop(false), n_busy(0) {
     // Initialize slaves
     for (unsigned int i=n_slaves; i--; ) {
-      slaves[i] = new Slave<Collect>(this,engines[i],stops[i]);
+      slaves[i] = new Slave<Collect>(this,engines[i],stops[i],i);
       static_cast<PortfolioStop*>(stops[i])->share(&tostop);
     }
   }
@@ -280,6 +281,22 @@ namespace Gecode { namespace Search { namespace Par {
     }
   }
 
+  template<class Collect>
+  unsigned int
+  PBS<Collect>::assets(void) const {
+    return n_slaves;
+  }
+
+  template<class Collect>
+  Statistics
+  PBS<Collect>::asset(unsigned int a) const {
+    assert(n_busy == 0);
+    for (unsigned int i=n_slaves; i--; )
+      if (slaves[i]->i == a)
+        return slaves[i]->statistics();
+    return Statistics();
+  }
+
   template<class Collect>
   PBS<Collect>::~PBS(void) {
     assert(n_busy == 0);
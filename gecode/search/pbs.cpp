@@ -35,6 +35,8 @@
 
 namespace Gecode { namespace Search { namespace Seq {
 
+  Spawn::~Spawn(void) {}
+
   Stop*
   pbsstop(Stop* so) {
     return new PortfolioStop(so);
@@ -42,11 +44,12 @@ namespace Gecode { namespace Search { namespace Seq {
 
   Engine*
   pbsengine(Engine** slaves, Stop** stops, unsigned int n_slaves,
-            const Statistics& stat, const Search::Options& opt, bool best) {
+            const Statistics& stat, const Search::Options& opt, bool best,
+            Spawn* sp) {
     if (best)
-      return new PBS<true>(slaves,stops,n_slaves,stat,opt);
+      return new PBS<true>(slaves,stops,n_slaves,stat,opt,sp);
     else
-      return new PBS<false>(slaves,stops,n_slaves,stat,opt);
+      return new PBS<false>(slaves,stops,n_slaves,stat,opt,sp);
   }
 
 }}}
@@ -64,14 +64,25 @@ namespace Gecode { namespace Search {
 
 namespace Gecode { namespace Search { namespace Seq {
 
+  /// Create engines for respawning assets of a portfolio
+  class GECODE_SEARCH_EXPORT Spawn : public HeapAllocated {
+  public:
+    /// Return engine for asset \a a at position \a i with stop \a so (or NULL)
+    virtual Engine* operator ()(unsigned int a, unsigned int i,
+                                Stop* so) const = 0;
+    /// Destructor
+    virtual ~Spawn(void);
+  };
+
   /// Create stop object
   GECODE_SEARCH_EXPORT Stop*
   pbsstop(Stop* so);
 
-  /// Create sequential portfolio engine
+  /// Create sequential portfolio engine (respawning assets with \a sp)
   GECODE_SEARCH_EXPORT Engine*
   pbsengine(Engine** slaves, Stop** stops, unsigned int n_slaves,
-            const Statistics& stat, const Search::Options& opt, bool best);
+            const Statistics& stat, const Search::Options& opt, bool best,
+            Spawn* sp=NULL);
 
 }}}
 
@@ -90,12 +101,114 @@ namespace Gecode { namespace Search { namespace Par {
 
 namespace Gecode { namespace Search {
 
+  /// Create engines for respawning assets of a portfolio
+  template<class T, template<class> class E>
+  class PbsSpawn : public Seq::Spawn {
+  protected:
+    /// The space to clone assets from
+    Space* m;
+    /// The options for engines (if built without builders)
+    Options o;
+    /// The engine builders (possibly NULL)
+    SEB* b;
+    /// Copies of the cutoffs of the builders (possibly NULL)
+    Cutoff** co;
+    /// Copies of the neighborhoods of the builders (possibly NULL)
+    Neighborhoods** nb;
+    /// The number of engine builders
+    int n;
+  public:
+    /// Initialize for master \a m0 and options \a o0
+    PbsSpawn(Space* m0, const Options& o0);
+    /// Initialize for master \a m0 and builders \a sebs
+    PbsSpawn(Space* m0, const SEBs& sebs);
+    /**
+     * \brief Return engine for asset \a a at position \a i with stop \a so
+     *
+     * As the cutoff and the neighborhoods are owned by the engine
+     * built, each engine is built with its own copies. If they cannot
+     * be copied, the asset is not respawned and NULL is returned.
+     */
+    virtual Engine* operator ()(unsigned int a, unsigned int i,
+                                Stop* so) const;
+    /// Destructor
+    virtual ~PbsSpawn(void);
+  };
+
+  template<class T, template<class> class E>
+  inline
+  PbsSpawn<T,E>::PbsSpawn(Space* m0, const Options& o0)
+    : m(m0->clone()), o(o0), b(NULL), co(NULL), nb(NULL), n(0) {}
+
+  template<class T, template<class> class E>
+  inline
+  PbsSpawn<T,E>::PbsSpawn(Space* m0, const SEBs& sebs)
+    : m(m0->clone()), b(heap.alloc<SEB>(sebs.size())),
+      co(heap.alloc<Cutoff*>(sebs.size())),
+      nb(heap.alloc<Neighborhoods*>(sebs.size())), n(sebs.size()) {
+    // Keep copies as the originals are owned by the engines built first
+    for (int i=0; i<n; i++) {
+      b[i] = sebs[i];
+      const Options& bo = b[i]->options();
+      co[i] = (bo.cutoff != NULL) ?
+        bo.cutoff->copy(static_cast<unsigned int>(i)) : NULL;
+      nb[i] = (bo.neighborhoods != NULL) ?
+        bo.neighborhoods->copy(static_cast<unsigned int>(i)) : NULL;
+    }
+  }
+
+  template<class T, template<class> class E>
+  Engine*
+  PbsSpawn<T,E>::operator ()(unsigned int a, unsigned int i,
+                             Stop* so) const {
+    if (b != NULL) {
+      Options& bo = b[i]->options();
+      // The original cutoff and neighborhoods might have been deleted
+      if (((bo.cutoff != NULL) && (co[i] == NULL)) ||
+          ((bo.neighborhoods != NULL) && (nb[i] == NULL)))
+        return NULL;
+      if (co[i] != NULL)
+        bo.cutoff = co[i]->copy(a);
+      if (nb[i] != NULL)
+        bo.neighborhoods = nb[i]->copy(a);
+      if (((co[i] != NULL) && (bo.cutoff == NULL)) ||
+          ((nb[i] != NULL) && (bo.neighborhoods == NULL))) {
+        delete bo.cutoff; delete bo.neighborhoods;
+        return NULL;
+      }
+      bo.stop = so;
+      Space* s = m->clone();
+      (void) s->slave(a);
+      return (*b[i])(s);
+    }
+    Space* s = m->clone();
+    (void) s->slave(a);
+    Options so_opt(o);
+    so_opt.stop = so;
+    return build<T,E>(s,so_opt);
+  }
+
+  template<class T, template<class> class E>
+  PbsSpawn<T,E>::~PbsSpawn(void) {
+    delete m;
+    for (int i=0; i<n; i++) {
+      delete b[i]; delete co[i]; delete nb[i];
+    }
+    heap.free<SEB>(b,n);
+    heap.free<Cutoff*>(co,n);
+    heap.free<Neighborhoods*>(nb,n);
+  }
+
+
   template<class T, template<class> class E>
   Engine*
   pbsseq(T* master, const Search::Statistics& stat, Options& opt) {
     Stop* stop = opt.stop;
     Region r;
 
+    // Assets do not write checkpoints
+    opt.checkpoint = NULL;
+
     // In case there are more threads than assets requested
     opt.threads = std::max(floor(opt.threads /
                                  static_cast<double>(opt.assets)),1.0);
@@ -107,6 +220,9 @@ namespace Gecode { namespace Search {
     WrapTraceRecorder::engine(opt.tracer,
                               SearchTracer::EngineType::PBS, n_slaves);
 
+    Seq::Spawn* sp = (opt.adaptive && E<T>::best) ?
+      new PbsSpawn<T,E>(master,opt) : NULL;
+
     for (unsigned int i=0; i<n_slaves; i++) {
       opt.stop = stops[i] = Seq::pbsstop(stop);
       Space* slave = (i == n_slaves-1) ?
@@ -115,7 +231,7 @@ namespace Gecode { namespace Search {
       slaves[i] = build<T,E>(slave,opt);
     }
 
-    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,E<T>::best);
+    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,E<T>::best,sp);
   }
 
   template<class T, template<class> class E>
@@ -131,19 +247,29 @@ namespace Gecode { namespace Search {
     WrapTraceRecorder::engine(opt.tracer,
                               SearchTracer::EngineType::PBS, n_slaves);
 
+    // Keep builders for respawning assets
+    Seq::Spawn* sp = NULL;
+    if (opt.adaptive && best) {
+      for (int i=0; i<n_slaves; i++)
+        sebs[i]->options().clone = false;
+      sp = new PbsSpawn<T,E>(master,sebs);
+    }
+
     for (int i=0; i<n_slaves; i++) {
       // Re-configure slave options
       stops[i] = Seq::pbsstop(sebs[i]->options().stop);
       sebs[i]->options().stop  = stops[i];
+      sebs[i]->options().checkpoint = NULL;
       sebs[i]->options().clone = false;
       Space* slave = (i == n_slaves-1) ?
         master : master->clone();
       (void) slave->slave(i);
       slaves[i] = (*sebs[i])(slave);
-      delete sebs[i];
+      if (sp == NULL)
+        delete sebs[i];
     }
 
-    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,best);
+    return Seq::pbsengine(slaves,stops,n_slaves,stat,opt,best,sp);
   }
 
 #ifdef GECODE_HAS_THREADS
@@ -154,6 +280,9 @@ namespace Gecode { namespace Search {
     Stop* stop = opt.stop;
     Region r;
 
+    // Assets do not write checkpoints
+    opt.checkpoint = NULL;
+
     // Limit the number of slaves to the number of threads
     unsigned int n_slaves = std::min(static_cast<unsigned int>(opt.threads),
                                      opt.assets);
@@ -197,6 +326,7 @@ namespace Gecode { namespace Search {
       // Re-configure slave options
       stops[i] = Par::pbsstop(sebs[i]->options().stop);
       sebs[i]->options().stop  = stops[i];
+      sebs[i]->options().checkpoint = NULL;
       sebs[i]->options().clone = false;
       Space* slave = (i == n_slaves-1) ?
         master : master->clone();
@@ -211,6 +341,43 @@ namespace Gecode { namespace Search {
     return Par::pbsengine(slaves,stops,n_slaves,stat,best);
   }
 
+  template<class T, template<class> class E>
+  Engine*
+  rbspar(T* s, const Options& o) {
+    Options opt(o.expand());
+    Search::Statistics stat;
+
+    stat.histograms(opt.instrument);
+    if (s->status(stat) == SS_FAILED) {
+      stat.failure(0);
+      if (!opt.clone)
+        delete s;
+      return Seq::dead(opt, stat);
+    }
+
+    T* master = opt.clone ? dynamic_cast<T*>(s->clone()) : s;
+    opt.clone = false;
+    // No portfolio master function, it might kill the branchers the
+    // engines share: each engine runs the master function on restarts
+
+    // One restart-based search per thread with its own cutoff sequence
+    int n = static_cast<int>(opt.threads);
+    SEBs sebs(n);
+    for (int i=0; i<n; i++) {
+      Options so(opt);
+      so.threads = 1.0;
+      so.independent = false;
+      if (i > 0) {
+        // Whether the cutoff can be copied has been checked by RBS
+        so.cutoff = opt.cutoff->copy(static_cast<unsigned int>(i));
+        assert(so.cutoff != NULL);
+      }
+      sebs[i] = new RbsBuilder<T,E>(so);
+    }
+
+    return pbspar<T,E>(master,sebs,stat,opt,E<T>::best);
+  }
+
 #endif
 
 }}
@@ -226,8 +393,9 @@ namespace Gecode {
 
     Search::Statistics stat;
 
+    stat.histograms(opt.instrument);
     if (s->status(stat) == SS_FAILED) {
-      stat.fail++;
+      stat.failure(0);
       if (!opt.clone)
         delete s;
       e = Search::Seq::dead(opt,stat);
@@ -274,8 +442,9 @@ namespace Gecode {
     Search::Options opt(o.expand());
     Search::Statistics stat;
 
+    stat.histograms(opt.instrument);
     if (s->status(stat) == SS_FAILED) {
-      stat.fail++;
+      stat.failure(0);
       if (!opt.clone)
         delete s;
       e = Search::Seq::dead(opt,stat);
@@ -325,6 +494,17 @@ namespace Gecode {
     build(s,sebs,o);
   }
 
+  template<class T, template<class> class E>
+  inline unsigned int
+  PBS<T,E>::assets(void) const {
+    return e->assets();
+  }
+  template<class T, template<class> class E>
+  inline Search::Statistics
+  PBS<T,E>::asset(unsigned int a) const {
+    return e->asset(a);
+  }
+
   template<class T, template<class> class E>
   inline T*
   pbs(T* s, const Search::Options& o) {
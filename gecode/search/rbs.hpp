@@ -52,6 +52,14 @@ namespace Gecode { namespace Search { namespace Seq {
 
 namespace Gecode { namespace Search {
 
+#ifdef GECODE_HAS_THREADS
+
+  /// Create parallel restart-based engine with independent restarts
+  template<class T, template<class> class E>
+  Engine* rbspar(T* s, const Options& o);
+
+#endif
+
   /// A RBS engine builder
   template<class T, template<class> class E>
   class RbsBuilder : public Builder {
@@ -83,14 +91,27 @@ namespace Gecode {
   RBS<T,E>::RBS(T* s, const Search::Options& m_opt) {
     if (m_opt.cutoff == NULL)
       throw Search::UninitializedCutoff("RBS::RBS");
+#ifdef GECODE_HAS_THREADS
+    if (m_opt.independent && (m_opt.expand().threads > 1.0)) {
+      // Every thread requires its own copy of the cutoff
+      Search::Cutoff* c = m_opt.cutoff->copy(0U);
+      if (c == NULL)
+        throw Search::UncopiableCutoff("RBS::RBS");
+      delete c;
+      e = Search::rbspar<T,E>(s,m_opt);
+      return;
+    }
+#endif
     Search::Options e_opt(m_opt.expand());
     Search::Statistics stat;
     e_opt.clone = false;
+    e_opt.checkpoint = NULL;
     e_opt.stop  = Search::Seq::rbsstop(m_opt.stop);
     Search::WrapTraceRecorder::engine(e_opt.tracer,
                                       SearchTracer::EngineType::RBS, 1U);
+    stat.histograms(m_opt.instrument);
     if (s->status(stat) == SS_FAILED) {
-      stat.fail++;
+      stat.failure(0);
       if (!m_opt.clone)
         delete s;
       e = Search::Seq::dead(e_opt, stat);
@@ -63,6 +63,16 @@ namespace Gecode { namespace Search { namespace Seq {
     int mark;
     /// Best solution found so far
     Space* best;
+    /// Whether archived paths to solutions are recorded
+    bool paths;
+    /// Archived path to best solution (only maintained for checkpoints or if recorded)
+    Archive bp;
+    /// Whether the best solution from a checkpoint must still be returned
+    bool resumed;
+    /// Write checkpoint
+    void checkpoint(void);
+    /// Resume from checkpoint (if there is one)
+    void resume(void);
   public:
     /// Initialize with space \a s and search options \a o
     BAB(Space* s, const Options& o);
@@ -70,6 +80,10 @@ namespace Gecode { namespace Search { namespace Seq {
     Space* next(void);
     /// Return statistics
     Statistics statistics(void) const;
+    /// Record archived paths to solutions
+    void record(void);
+    /// Return archived path to last solution found (if recorded)
+    const Archive& solution(void) const;
     /// Constrain future solutions to be better than \a b
     void constrain(const Space& b);
     /// Reset engine to restart at space \a s
@@ -40,22 +40,91 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0), mark(0), 
-      best(NULL) {
+    : tracer(o.tracer), opt(o), path(opt.nogoods_limit,opt.memory,opt.batch), d(0), mark(0),
+      best(NULL), paths(false), resumed(false) {
+    instrument(opt.instrument);
+    // Checkpoints require paths from the root
+    if (opt.checkpoint != NULL)
+      path.keep();
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::BAB, 1U);
       tracer.worker();
     }
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
-      fail++;
+      failure(0);
       cur = NULL;
       if (!o.clone)
         delete s;
     } else {
       cur = snapshot(s,opt);
+      if ((opt.checkpoint != NULL) && opt.checkpoint->resume())
+        resume();
     }
   }
 
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::checkpoint(void) {
+    // Due to the invariant, the path describes the open search tree
+    Archive e;
+    e << static_cast<unsigned int>((cur == NULL) && path.empty());
+    path.checkpoint(e);
+    e << static_cast<unsigned int>(bp.size() > 0);
+    for (int i=0; i<bp.size(); i++)
+      e << bp[i];
+    opt.checkpoint->write(e);
+  }
+
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::resume(void) {
+    Archive e;
+    if (!opt.checkpoint->read(e))
+      return;
+    // Check that the checkpoint is complete before rebuilding the paths
+    int i = 1;
+    if (!Path<Tracer>::skip(e,i) || (i >= e.size()) ||
+        ((e[i++] != 0U) && !Path<Tracer>::skip(e,i))) {
+      delete cur;
+      cur = NULL;
+      throw CheckpointFailure("BAB::resume");
+    }
+    Space* r = cur->clone();
+    i = 0;
+    bool done = (e[i++] != 0U);
+    cur = path.resume(cur,e,i,*this,tracer);
+    if (done) {
+      delete cur;
+      cur = NULL;
+    } else if (cur == NULL) {
+      path.next();
+    }
+    if (e[i++] == 0U) {
+      delete r;
+      return;
+    }
+    // Replay path to best solution
+    int f = i;
+    Path<Tracer> p(0);
+    Space* b = p.resume(r,e,i,*this,tracer);
+    p.reset();
+    if (b == NULL)
+      return;
+    if (b->status(*this) != SS_SOLVED) {
+      delete b;
+      return;
+    }
+    // Deletes all pending branchers
+    (void) b->choice();
+    best = b;
+    for (; f<i; f++)
+      bp << e[f];
+    if (cur != NULL)
+      cur->constrain(*best);
+    mark = path.entries();
+    resumed = true;
+  }
+
   template<class Tracer>
   forceinline Space*
   BAB<Tracer>::next(void) {
@@ -76,14 +145,31 @@ namespace Gecode { namespace Search { namespace Seq {
      *
      */
     start();
+    if (resumed) {
+      resumed = false;
+      return best->clone();
+    }
     while (true) {
-      if (stop(opt))
+      if (stop(opt)) {
+        if (opt.checkpoint != NULL)
+          checkpoint();
         return NULL;
+      }
+      if ((opt.checkpoint != NULL) &&
+          ((node % Config::checkpoint_nodes) == 0UL) &&
+          opt.checkpoint->due())
+        checkpoint();
       // Recompute and add constraint if necessary
       while (cur == NULL) {
-        if (path.empty())
+        if (path.empty()) {
+          if (opt.checkpoint != NULL)
+            checkpoint();
           return NULL;
-        cur = path.recompute(d,opt.a_d,*this,*best,mark,tracer);
+        }
+        {
+          Measure m(*this,t_recompute);
+          cur = path.recompute(d,opt.a_d,*this,*best,mark,tracer);
+        }
         if (cur != NULL)
           break;
         path.next();
@@ -95,14 +181,14 @@ namespace Gecode { namespace Search { namespace Seq {
         ei.init(tracer.wid(), top.nid(), top.truealt(), *cur, *top.choice());
       }
       unsigned int nid = tracer.nid();
-      switch (cur->status(*this)) {
+      switch (path.status(*this,*cur)) {
       case SS_FAILED:
         if (tracer) {
           SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
                                     tracer.wid(), nid, *cur);
           tracer.node(ei,ni);
         }
-        fail++;
+        failure(static_cast<unsigned long int>(path.entries()));
         delete cur;
         cur = NULL;
         path.next();
@@ -116,6 +202,10 @@ namespace Gecode { namespace Search { namespace Seq {
           }
           // Deletes all pending branchers
           (void) cur->choice();
+          if (paths || (opt.checkpoint != NULL)) {
+            bp = Archive();
+            path.checkpoint(bp);
+          }
           delete best;
           best = cur;
           cur = NULL;
@@ -126,8 +216,8 @@ namespace Gecode { namespace Search { namespace Seq {
       case SS_BRANCH:
         {
           Space* c;
-          if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+          if (path.copy(d,opt.c_d)) {
+            c = path.clone(*this,*cur);
             d = 1;
           } else {
             c = NULL;
@@ -156,6 +246,19 @@ namespace Gecode { namespace Search { namespace Seq {
     return *this;
   }
 
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::record(void) {
+    paths = true;
+    path.keep();
+  }
+
+  template<class Tracer>
+  forceinline const Archive&
+  BAB<Tracer>::solution(void) const {
+    return bp;
+  }
+
   template<class Tracer>
   forceinline void
   BAB<Tracer>::constrain(const Space& b) {
@@ -168,6 +271,7 @@ namespace Gecode { namespace Search { namespace Seq {
         delete best;
     }
     best = b.clone();
+    bp = Archive();
     if (cur != NULL)
       cur->constrain(b);
     mark = path.entries();
@@ -179,6 +283,8 @@ namespace Gecode { namespace Search { namespace Seq {
     tracer.round();
     delete best;
     best = NULL;
+    bp = Archive();
+    resumed = false;
     path.reset();
     d = 0;
     mark = 0;
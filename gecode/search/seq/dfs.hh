@@ -55,6 +55,14 @@ namespace Gecode { namespace Search { namespace Seq {
     Space* cur;
     /// Distance until next clone
     unsigned int d;
+    /// Whether archived paths to solutions are recorded
+    bool paths;
+    /// Archived path to last solution (only maintained if recorded)
+    Archive sp;
+    /// Write checkpoint
+    void checkpoint(void);
+    /// Resume from checkpoint (if there is one)
+    void resume(void);
   public:
     /// Initialize for space \a s with options \a o
     DFS(Space* s, const Options& o);
@@ -62,6 +70,10 @@ namespace Gecode { namespace Search { namespace Seq {
     Space* next(void);
     /// Return statistics
     Statistics statistics(void) const;
+    /// Record archived paths to solutions
+    void record(void);
+    /// Return archived path to last solution found (if recorded)
+    const Archive& solution(void) const;
     /// Constrain future solutions to be better than \a b (should never be called)
     void constrain(const Space& b);
     /// Reset engine to restart at space \a s
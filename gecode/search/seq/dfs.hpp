@@ -36,18 +36,59 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0) {
+    : tracer(o.tracer), opt(o), path(opt.nogoods_limit,opt.memory,opt.batch), d(0),
+      paths(false) {
+    instrument(opt.instrument);
+    // Checkpoints require paths from the root
+    if (opt.checkpoint != NULL)
+      path.keep();
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::DFS, 1U);
       tracer.worker();
     }
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
-      fail++;
+      failure(0);
       cur = NULL;
       if (!opt.clone)
         delete s;
     } else {
       cur = snapshot(s,opt);
+      if ((opt.checkpoint != NULL) && opt.checkpoint->resume())
+        resume();
+    }
+  }
+
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::checkpoint(void) {
+    // Due to the invariant, the path describes the open search tree
+    Archive e;
+    e << static_cast<unsigned int>((cur == NULL) && path.empty());
+    path.checkpoint(e);
+    opt.checkpoint->write(e);
+  }
+
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::resume(void) {
+    Archive e;
+    if (!opt.checkpoint->read(e))
+      return;
+    // Check that the checkpoint is complete before rebuilding the path
+    int i = 1;
+    if (!Path<Tracer>::skip(e,i)) {
+      delete cur;
+      cur = NULL;
+      throw CheckpointFailure("DFS::resume");
+    }
+    i = 0;
+    bool done = (e[i++] != 0U);
+    cur = path.resume(cur,e,i,*this,tracer);
+    if (done) {
+      delete cur;
+      cur = NULL;
+    } else if (cur == NULL) {
+      path.next();
     }
   }
 
@@ -89,12 +130,25 @@ namespace Gecode { namespace Search { namespace Seq {
      */
     start();
     while (true) {
-      if (stop(opt))
+      if (stop(opt)) {
+        if (opt.checkpoint != NULL)
+          checkpoint();
         return NULL;
+      }
+      if ((opt.checkpoint != NULL) &&
+          ((node % Config::checkpoint_nodes) == 0UL) &&
+          opt.checkpoint->due())
+        checkpoint();
       while (cur == NULL) {
-        if (path.empty())
+        if (path.empty()) {
+          if (opt.checkpoint != NULL)
+            checkpoint();
           return NULL;
-        cur = path.recompute(d,opt.a_d,*this,tracer);
+        }
+        {
+          Measure m(*this,t_recompute);
+          cur = path.recompute(d,opt.a_d,*this,tracer);
+        }
         if (cur != NULL)
           break;
         path.next();
@@ -106,14 +160,14 @@ namespace Gecode { namespace Search { namespace Seq {
         ei.init(tracer.wid(), top.nid(), top.truealt(), *cur, *top.choice());
       }
       unsigned int nid = tracer.nid();
-      switch (cur->status(*this)) {
+      switch (path.status(*this,*cur)) {
       case SS_FAILED:
         if (tracer) {
           SearchTracer::NodeInfo ni(SearchTracer::NodeType::FAILED,
                                     tracer.wid(), nid, *cur);
           tracer.node(ei,ni);
         }
-        fail++;
+        failure(static_cast<unsigned long int>(path.entries()));
         delete cur;
         cur = NULL;
         path.next();
@@ -127,6 +181,10 @@ namespace Gecode { namespace Search { namespace Seq {
           }
           // Deletes all pending branchers
           (void) cur->choice();
+          if (paths) {
+            sp = Archive();
+            path.checkpoint(sp);
+          }
           Space* s = cur;
           cur = NULL;
           path.next();
@@ -135,8 +193,8 @@ namespace Gecode { namespace Search { namespace Seq {
       case SS_BRANCH:
         {
           Space* c;
-          if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+          if (path.copy(d,opt.c_d)) {
+            c = path.clone(*this,*cur);
             d = 1;
           } else {
             c = NULL;
@@ -165,6 +223,19 @@ namespace Gecode { namespace Search { namespace Seq {
     return *this;
   }
 
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::record(void) {
+    paths = true;
+    path.keep();
+  }
+
+  template<class Tracer>
+  forceinline const Archive&
+  DFS<Tracer>::solution(void) const {
+    return sp;
+  }
+
   template<class Tracer>
   forceinline void
   DFS<Tracer>::constrain(const Space& b) {
@@ -91,6 +91,7 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline
   Probe<Tracer>::Probe(const Options& opt)
     : tracer(opt.tracer), ds(heap) {
+    instrument(opt.instrument);
     tracer.engine(SearchTracer::EngineType::LDS, 1U);
     tracer.worker();
   }
@@ -197,7 +198,7 @@ namespace Gecode { namespace Search { namespace Seq {
                                       tracer.wid(), tracer.nid(), *s);
             tracer.node(*tracer.ei(),ni);
           }
-          fail++;
+          failure(static_cast<unsigned long int>(ds.entries()));
           delete s;
           goto backtrack;
         } else {
@@ -219,7 +220,7 @@ namespace Gecode { namespace Search { namespace Seq {
                                       tracer.wid(), tracer.nid(), *cur);
             tracer.node(*tracer.ei(),ni);
           }
-          fail++;
+          failure(static_cast<unsigned long int>(ds.entries()));
           delete cur;
           cur = NULL;
           goto backtrack;
@@ -273,7 +274,7 @@ namespace Gecode { namespace Search { namespace Seq {
     : opt(o), e(opt), root(NULL), d(0) {
     e.node = 1;
     if (s->status(e) == SS_FAILED) {
-      e.fail++;
+      e.failure(0);
       e.init(NULL);
     } else {
       Space* c = snapshot(s,opt);
@@ -324,7 +325,7 @@ namespace Gecode { namespace Search { namespace Seq {
     e.node = 1;
     if ((s == NULL) || (s->status(e) == SS_FAILED)) {
       delete s;
-      e.fail++;
+      e.failure(0);
       e.reset(NULL,0);
     } else {
       if (opt.d_l > 0) {
@@ -0,0 +1,132 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/seq/lns.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  double
+  LNS::improvement(const Space& s) const {
+    long long int o, n;
+    if ((last == NULL) || !last->objective(o) || !s.objective(n))
+      return 1.0;
+    if (n >= o)
+      return 0.0;
+    return std::min(1.0, static_cast<double>(o - n) /
+                    std::max(1.0, std::fabs(static_cast<double>(o))));
+  }
+
+  Space*
+  LNS::next(void) {
+    while (true) {
+      if (restart) {
+        // Relax the last solution by the next neighborhood
+        restart = false;
+        if (!stop->enginestopped())
+          stop->m_stat.restart++;
+        cur = static_cast<int>(nb->select());
+        stop->limit(e->statistics(),++(*co));
+        Space* slave = master->clone();
+        slave->constrain(*last);
+        complete = nb->relax(static_cast<unsigned int>(cur),*slave,*last);
+        e->reset(slave);
+      }
+      Space* n = e->next();
+      if (n != NULL) {
+        // The engine found a better solution
+        if (cur >= 0)
+          nb->improved(static_cast<unsigned int>(cur),improvement(*n));
+        restart = true;
+        delete last;
+        last = n->clone();
+        return n;
+      } else if (e->stopped() && !stop->enginestopped()) {
+        // The meta engine must be stopped
+        return NULL;
+      } else if (!e->stopped() && complete) {
+        // The last neighborhood did not constrain any variable
+        return NULL;
+      }
+      if (e->stopped())
+        nb->limited(static_cast<unsigned int>(cur));
+      else
+        nb->exhausted(static_cast<unsigned int>(cur));
+      restart = true;
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Search::Statistics
+  LNS::statistics(void) const {
+    return stop->metastatistics()+e->statistics();
+  }
+
+  void
+  LNS::constrain(const Space& b) {
+    if (last != NULL) {
+      last->constrain(b);
+      if (last->status() == SS_FAILED) {
+        delete last;
+      } else {
+        return;
+      }
+    }
+    last = b.clone();
+    if (best)
+      e->constrain(b);
+    // Continue from the better solution
+    restart = true;
+  }
+
+  bool
+  LNS::stopped(void) const {
+    return e->stopped();
+  }
+
+  LNS::~LNS(void) {
+    delete e;
+    delete master;
+    delete last;
+    delete co;
+    delete nb;
+    delete stop;
+  }
+
+}}}
+
+// STATISTICS: search-seq
@@ -0,0 +1,90 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_SEQ_LNS_HH__
+#define __GECODE_SEARCH_SEQ_LNS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/seq/rbs.hh>
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  /// Engine for large neighborhood search
+  class GECODE_SEARCH_EXPORT LNS : public Engine {
+  protected:
+    /// The engine exploring neighborhoods
+    Engine* e;
+    /// The master space to relax from
+    Space* master;
+    /// The last solution space (possibly NULL)
+    Space* last;
+    /// The cutoff object for the fail limit of a neighborhood
+    Cutoff* co;
+    /// The neighborhoods
+    Neighborhoods* nb;
+    /// The stop control object
+    RestartStop* stop;
+    /// The neighborhood being explored (-1 for the initial search)
+    int cur;
+    /// Whether search in the current neighborhood is complete
+    bool complete;
+    /// Whether a new neighborhood must be explored when next is called
+    bool restart;
+    /// Whether the engine exploring neighborhoods does best solution search
+    bool best;
+    /// Return improvement of solution \a s with respect to last solution
+    double improvement(const Space& s) const;
+  public:
+    /// Constructor
+    LNS(Space* s, RestartStop* stop0, Engine* e0,
+        const Search::Statistics& stat, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~LNS(void);
+  };
+
+}}}
+
+#include <gecode/search/seq/lns.hpp>
+
+#endif
+
+// STATISTICS: search-seq
@@ -35,6 +35,7 @@
 #define __GECODE_SEARCH_SEQ_PATH_HH__
 
 #include <algorithm>
+#include <cmath>
 
 #include <gecode/search.hh>
 #include <gecode/search/support.hh>
@@ -43,6 +44,47 @@
 
 namespace Gecode { namespace Search { namespace Seq {
 
+  /**
+   * \brief Memory budget for the clones stored on a path
+   *
+   * The size of clones, the time for cloning, and the time for
+   * propagation after a commit are estimated from measurements
+   * during search. The commit distance balances the time for
+   * cloning against the time for recomputation and is increased such
+   * that the clones on a path of the current depth fit into the
+   * budget.
+   */
+  class Budget {
+  protected:
+    /// Budget in bytes (zero if there is no budget)
+    size_t b;
+    /// Estimated size of a clone in bytes
+    double s;
+    /// Estimated time for cloning in milliseconds
+    double t_c;
+    /// Estimated time for propagation after a commit in milliseconds
+    double t_p;
+    /// Timer for measurements
+    Support::Timer t;
+    /// Update estimate \a e by measurement \a m
+    static void update(double& e, double m);
+  public:
+    /// Initialize with budget \a b in bytes
+    Budget(size_t b);
+    /// Test whether there is a budget
+    operator bool(void) const;
+    /// Start measurement
+    void start(void);
+    /// Finish measurement of cloning that created \a c
+    void cloned(const Space& c);
+    /// Finish measurement of propagation
+    void propagated(void);
+    /// Return commit distance for a path with \a n entries
+    unsigned int distance(int n) const;
+    /// Test whether a clone fits if \a m bytes are used by clones
+    bool admit(size_t m) const;
+  };
+
   /**
    * \brief Depth-first path (stack of edges) supporting recomputation
    *
@@ -55,6 +97,9 @@ namespace Gecode { namespace Search { namespace Seq {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * The path keeps track of the memory used by its clones. With a
+   * memory budget, it also decides where clones are created.
+   *
    */
   template<class Tracer>
   class GECODE_VTABLE_EXPORT Path : public NoGoods {
@@ -78,6 +123,8 @@ namespace Gecode { namespace Search { namespace Seq {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c, unsigned int nid);
+      /// Edge for choice \a ch at alternative \a a with clone \a c (possibly NULL)
+      Edge(const Choice* ch, Space* c, unsigned int a, unsigned int nid);
 
       /// Return space for edge
       Space* space(void) const;
@@ -111,13 +158,35 @@ namespace Gecode { namespace Search { namespace Seq {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
+    /// Memory budget for clones
+    Budget _b;
+    /// Memory used by clones on the stack (in bytes)
+    size_t _mem;
+    /// Whether to use strict batch recomputation
+    bool _batch;
+    /// Whether all edges are kept so that the path starts at the root
+    bool _keep;
+    /// Account for clone \a c being stored on the stack
+    void store(Worker& stat, const Space* c);
+    /// Account for clone \a c being removed from the stack
+    void remove(const Space* c);
+    /// Pop and dispose topmost edge
+    void pop(void);
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l, memory budget \a b, and whether to use strict batch recomputation \a bt
+    Path(unsigned int l, size_t b=0, bool bt=false);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Keep all edges (no reuse of edges by LAO) for complete paths
+    void keep(void);
+    /// Test whether to clone at distance \a d from last clone (commit distance \a c_d)
+    bool copy(unsigned int d, unsigned int c_d) const;
+    /// Return clone of \a s to be pushed
+    Space* clone(Worker& stat, const Space& s);
+    /// Perform propagation on \a s
+    SpaceStatus status(Worker& stat, Space& s);
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
     /// Generate path for next node
@@ -145,6 +214,27 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(void);
     /// Post no-goods
     virtual void post(Space& home) const;
+    /// Archive no-goods
+    virtual void archive(Archive& e) const;
+    /// Archive all choices and alternatives of path into \a e
+    void checkpoint(Archive& e) const;
+    /**
+     * \brief Rebuild path from checkpoint \a e for root space \a s
+     *
+     * The path is read from position \a i in \a e, \a i is updated
+     * to the first position after the path. Returns the space the
+     * path points to or NULL if the space is failed.
+     */
+    Space* resume(Space* s, const Archive& e, int& i, Worker& stat,
+                  Tracer& t);
+    /**
+     * \brief Skip path in checkpoint \a e
+     *
+     * The path is read from position \a i in \a e, \a i is updated
+     * to the first position after the path. Returns false if \a e
+     * does not contain a complete path.
+     */
+    static bool skip(const Archive& e, int& i);
   };
 
 }}}
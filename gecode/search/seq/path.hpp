@@ -33,6 +33,59 @@
 
 namespace Gecode { namespace Search { namespace Seq {
 
+  /*
+   * Memory budget
+   *
+   */
+
+  forceinline
+  Budget::Budget(size_t b0)
+    : b(b0), s(0.0), t_c(0.0), t_p(0.0) {}
+
+  forceinline
+  Budget::operator bool(void) const {
+    return b > 0;
+  }
+
+  forceinline void
+  Budget::update(double& e, double m) {
+    e = (e == 0.0) ? m : (3.0*e + m) / 4.0;
+  }
+
+  forceinline void
+  Budget::start(void) {
+    t.start();
+  }
+
+  forceinline void
+  Budget::cloned(const Space& c) {
+    update(t_c,t.stop());
+    update(s,static_cast<double>(c.allocated()));
+  }
+
+  forceinline void
+  Budget::propagated(void) {
+    update(t_p,t.stop());
+  }
+
+  forceinline unsigned int
+  Budget::distance(int n) const {
+    // Balance time for cloning against time for recomputation
+    double k = (t_p > 0.0) ? std::sqrt(2.0 * t_c / t_p) : 1.0;
+    // Make the clones for a path with n entries fit into the budget
+    double m = std::ceil(static_cast<double>(n+1) * s /
+                         static_cast<double>(b));
+    double d = std::min(std::max(std::max(k,m),1.0),
+                        static_cast<double>(n+1));
+    return static_cast<unsigned int>(d);
+  }
+
+  forceinline bool
+  Budget::admit(size_t m) const {
+    return static_cast<double>(m) + s <= static_cast<double>(b);
+  }
+
+
   /*
    * Edge for recomputation
    *
@@ -46,6 +99,12 @@ namespace Gecode { namespace Search { namespace Seq {
   Path<Tracer>::Edge::Edge(Space* s, Space* c, unsigned int nid)
     : _space(c), _alt(0), _choice(s->choice()), _nid(nid) {}
 
+  template<class Tracer>
+  forceinline
+  Path<Tracer>::Edge::Edge(const Choice* ch, Space* c, unsigned int a,
+                           unsigned int nid)
+    : _space(c), _alt(a), _choice(ch), _nid(nid) {}
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::Edge::space(void) const {
@@ -116,8 +175,8 @@ namespace Gecode { namespace Search { namespace Seq {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l) {}
+  Path<Tracer>::Path(unsigned int l, size_t b, bool bt)
+    : ds(heap), _ngdl(l), _b(b), _mem(0), _batch(bt), _keep(false) {}
 
   template<class Tracer>
   forceinline unsigned int
@@ -131,13 +190,79 @@ namespace Gecode { namespace Search { namespace Seq {
     _ngdl = l;
   }
 
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::keep(void) {
+    _keep = true;
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::store(Worker& stat, const Space* c) {
+    _mem += c->allocated();
+    if (stat.memory < _mem)
+      stat.memory = _mem;
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::remove(const Space* c) {
+    _mem -= c->allocated();
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::pop(void) {
+    Edge e = ds.pop();
+    if (e.space() != NULL)
+      remove(e.space());
+    e.dispose();
+  }
+
+  template<class Tracer>
+  forceinline bool
+  Path<Tracer>::copy(unsigned int d, unsigned int c_d) const {
+    if (d == 0)
+      return true;
+    if (!_b)
+      return d >= c_d;
+    return (d >= _b.distance(ds.entries())) && _b.admit(_mem);
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  Path<Tracer>::clone(Worker& stat, const Space& s) {
+    stat.clone++;
+    Measure m(stat,stat.t_clone);
+    if (!_b)
+      return s.clone();
+    _b.start();
+    Space* c = s.clone();
+    _b.cloned(*c);
+    return c;
+  }
+
+  template<class Tracer>
+  forceinline SpaceStatus
+  Path<Tracer>::status(Worker& stat, Space& s) {
+    Measure m(stat,stat.t_propagate);
+    if (!_b)
+      return s.status(stat);
+    _b.start();
+    SpaceStatus ss = s.status(stat);
+    _b.propagated();
+    return ss;
+  }
+
   template<class Tracer>
   forceinline const Choice*
   Path<Tracer>::push(Worker& stat, Space* s, Space* c, unsigned int nid) {
     if (!ds.empty() && ds.top().lao()) {
       // Topmost stack entry was LAO -> reuse
-      ds.pop().dispose();
+      pop();
     }
+    if (c != NULL)
+      store(stat,c);
     Edge sn(s,c,nid);
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
@@ -149,7 +274,7 @@ namespace Gecode { namespace Search { namespace Seq {
   Path<Tracer>::next(void) {
     while (!ds.empty())
       if (ds.top().rightmost()) {
-        ds.pop().dispose();
+        pop();
       } else {
         ds.top().next();
         return;
@@ -204,11 +329,11 @@ namespace Gecode { namespace Search { namespace Seq {
           SearchTracer::EdgeInfo ei(t.wid(),top.nid(),a);
           t.skip(ei);
         }
-        ds.pop().dispose();
+        pop();
       }
     } else {
       for (int i=l; i<n; i++)
-        ds.pop().dispose();
+        pop();
     }
     assert(ds.entries() == l);
   }
@@ -217,7 +342,7 @@ namespace Gecode { namespace Search { namespace Seq {
   inline void
   Path<Tracer>::reset(void) {
     while (!ds.empty())
-      ds.pop().dispose();
+      pop();
   }
 
   template<class Tracer>
@@ -231,11 +356,12 @@ namespace Gecode { namespace Search { namespace Seq {
     // Check for LAO
     if ((ds.top().space() != NULL) && ds.top().rightmost()) {
       Space* s = ds.top().space();
+      remove(s);
       s->commit(*ds.top().choice(),ds.top().alt());
       assert(ds.entries()-1 == lc());
       ds.top().space(NULL);
       // Mark as reusable
-      if (static_cast<unsigned int>(ds.entries()) > ngdl())
+      if (!_keep && (static_cast<unsigned int>(ds.entries()) > ngdl()))
         ds.top().next();
       d = 0;
       return s;
@@ -245,10 +371,11 @@ namespace Gecode { namespace Search { namespace Seq {
     int n = ds.entries();     // Number of stack entries
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
+    stat.recompute++;
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = clone(stat,*ds[l].space()); // Last clone
 
-    if (d < a_d) {
+    if (_batch || (d < a_d)) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
         commit(s,i);
@@ -261,8 +388,8 @@ namespace Gecode { namespace Search { namespace Seq {
       // Skip over all rightmost branches
       for (; (i<n) && ds[i].rightmost(); i++)
         commit(s,i);
-      // Is there any point to make a copy?
-      if (i<n-1) {
+      // Is there any point to make a copy (that fits into the budget)?
+      if ((i<n-1) && (!_b || _b.admit(_mem))) {
         // Propagate to fixpoint
         SpaceStatus ss = s->status(stat);
         /*
@@ -272,11 +399,13 @@ namespace Gecode { namespace Search { namespace Seq {
         if (ss == SS_FAILED) {
           // s must be deleted as it is not on the stack
           delete s;
-          stat.fail++;
+          stat.failure(static_cast<unsigned long int>(i));
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        Space* c = clone(stat,*s);
+        store(stat,c);
+        ds[i].space(c);
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -298,6 +427,7 @@ namespace Gecode { namespace Search { namespace Seq {
     // Check for LAO
     if ((ds.top().space() != NULL) && ds.top().rightmost()) {
       Space* s = ds.top().space();
+      remove(s);
       s->commit(*ds.top().choice(),ds.top().alt());
       assert(ds.entries()-1 == lc());
       if (mark > ds.entries()-1) {
@@ -306,7 +436,7 @@ namespace Gecode { namespace Search { namespace Seq {
       }
       ds.top().space(NULL);
       // Mark as reusable
-      if (static_cast<unsigned int>(ds.entries()) > ngdl())
+      if (!_keep && (static_cast<unsigned int>(ds.entries()) > ngdl()))
         ds.top().next();
       d = 0;
       return s;
@@ -318,28 +448,41 @@ namespace Gecode { namespace Search { namespace Seq {
     d = static_cast<unsigned int>(n - l);
 
     Space* s = ds[l].space(); // Last clone
+    stat.recompute++;
 
-    if (l < mark) {
+    if (_batch) {
+      // Only the recomputed space is constrained, the clone on the
+      // stack stays as is and is constrained again when reused
+      s = clone(stat,*s);
+      if (l < mark)
+        s->constrain(best);
+    } else if (l < mark) {
       mark = l;
+      // The space stays on the stack but changes its memory
+      remove(s);
       s->constrain(best);
+      SpaceStatus ss = s->status(stat);
+      store(stat,s);
       // The space on the stack could be failed now as an additional
       // constraint might have been added.
-      if (s->status(stat) == SS_FAILED) {
+      if (ss == SS_FAILED) {
         // s does not need deletion as it is on the stack (unwind does this)
-        stat.fail++;
+        stat.failure(static_cast<unsigned long int>(l));
         unwind(l,t);
         return NULL;
       }
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = clone(stat,*s);
+      remove(s);
+      store(stat,c);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = clone(stat,*s);
     }
 
-    if (d < a_d) {
+    if (_batch || (d < a_d)) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
         commit(s,i);
@@ -352,8 +495,8 @@ namespace Gecode { namespace Search { namespace Seq {
       // Skip over all rightmost branches
       for (; (i<n) && ds[i].rightmost(); i++)
         commit(s,i);
-      // Is there any point to make a copy?
-      if (i<n-1) {
+      // Is there any point to make a copy (that fits into the budget)?
+      if ((i<n-1) && (!_b || _b.admit(_mem))) {
         // Propagate to fixpoint
         SpaceStatus ss = s->status(stat);
         /*
@@ -366,11 +509,13 @@ namespace Gecode { namespace Search { namespace Seq {
         if (ss == SS_FAILED) {
           // s must be deleted as it is not on the stack
           delete s;
-          stat.fail++;
+          stat.failure(static_cast<unsigned long int>(i));
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        Space* c = clone(stat,*s);
+        store(stat,c);
+        ds[i].space(c);
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -386,6 +531,81 @@ namespace Gecode { namespace Search { namespace Seq {
     GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::archive(Archive& e) const {
+    NoGoodsProp::archive(*this,e);
+  }
+
+  template<class Tracer>
+  void
+  Path<Tracer>::checkpoint(Archive& e) const {
+    e << ds.entries();
+    for (int i=0; i<ds.entries(); i++) {
+      Archive c;
+      ds[i].choice()->archive(c);
+      e << ds[i].truealt() << c.size();
+      for (int j=0; j<c.size(); j++)
+        e << c[j];
+    }
+  }
+
+  template<class Tracer>
+  Space*
+  Path<Tracer>::resume(Space* s, const Archive& e, int& i, Worker& stat,
+                       Tracer& t) {
+    assert(ds.empty());
+    int n = static_cast<int>(e[i++]);
+    for (int k=0; k<n; k++) {
+      unsigned int a = e[i++];
+      int m = static_cast<int>(e[i++]);
+      Archive ca;
+      for (int j=0; j<m; j++)
+        ca << e[i++];
+      // Skip the rest of the path once the space has failed
+      if (s == NULL)
+        continue;
+      if (s->status(stat) == SS_FAILED) {
+        stat.failure(static_cast<unsigned long int>(k));
+        delete s;
+        s = NULL;
+        continue;
+      }
+      // Only the root is stored, the rest is recomputed
+      Space* c = NULL;
+      if (k == 0) {
+        c = clone(stat,*s);
+        store(stat,c);
+      }
+      Edge en(s->choice(ca), c, a, t.nid());
+      ds.push(en);
+      s->commit(*en.choice(),a);
+    }
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+    return s;
+  }
+
+  template<class Tracer>
+  bool
+  Path<Tracer>::skip(const Archive& e, int& i) {
+    if (i >= e.size())
+      return false;
+    int n = static_cast<int>(e[i++]);
+    if (n < 0)
+      return false;
+    for (int k=0; k<n; k++) {
+      // Alternative and size of the choice, followed by the choice
+      if (e.size() - i < 2)
+        return false;
+      i++;
+      int m = static_cast<int>(e[i++]);
+      if ((m < 0) || (e.size() - i < m))
+        return false;
+      i += m;
+    }
+    return true;
+  }
+
 }}}
 
 // STATISTICS: search-seq
@@ -71,8 +71,26 @@ namespace Gecode { namespace Search { namespace Seq {
     /// Stop object
     Stop* stop;
   public:
-    /// Initialize with slave \a s and its stop object \a so
-    void init(Engine* s, Stop* so);
+    /// Position of the asset in the portfolio
+    unsigned int i;
+    /// Failure limit for the current turn
+    unsigned long int l;
+    /// Number of slices per turn
+    unsigned int w;
+    /// Number of turns without progress
+    unsigned int stall;
+    /// Whether the slave has made progress during the current turn
+    bool progress;
+    /// Whether the slave has ever made progress
+    bool sol;
+    /// Initialize with slave \a s, its stop object \a so, and position \a i
+    void init(Engine* s, Stop* so, unsigned int i, unsigned long int l);
+    /// Replace engine by \a s
+    void respawn(Engine* s);
+    /// Return stop object
+    Stop* stopper(void) const;
+    /// Return failures of current engine
+    unsigned long int fail(void) const;
     /// Return next solution
     Space* next(void);
     /// Return statistics of slave
@@ -105,10 +123,24 @@ namespace Gecode { namespace Search { namespace Seq {
     unsigned int cur;
     /// Whether a slave has been stopped
     bool slave_stop;
+    /// Whether the portfolio adapts to the progress of its assets
+    bool adaptive;
+    /// Number of assets
+    unsigned int n_assets;
+    /// Statistics of assets that have finished
+    Statistics* as;
+    /// Number of assets respawned so far
+    unsigned int n_spawned;
+    /// Engine creation for respawning assets (possibly NULL)
+    Spawn* sp;
+    /// Best solution so far (only if assets are respawned)
+    Space* b;
+    /// Schedule next turn of slave \a i after its turn has ended
+    void schedule(unsigned int i);
   public:
     /// Initialize
     PBS(Engine** slaves, Stop** stops, unsigned int n,
-        const Statistics& stat, const Search::Options& opt);
+        const Statistics& stat, const Search::Options& opt, Spawn* sp);
     /// Return next solution (NULL, if none exists or search has been stopped)
     virtual Space* next(void);
     /// Return statistics
@@ -117,6 +149,10 @@ namespace Gecode { namespace Search { namespace Seq {
     virtual bool stopped(void) const;
     /// Constrain future solutions to be better than \a b
     virtual void constrain(const Space& b);
+    /// Return number of assets
+    virtual unsigned int assets(void) const;
+    /// Return statistics of asset \a a
+    virtual Statistics asset(unsigned int a) const;
     /// Destructor
     virtual ~PBS(void);
   };
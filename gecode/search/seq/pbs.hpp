@@ -32,6 +32,7 @@
  */
 
 #include <climits>
+#include <algorithm>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -46,8 +47,23 @@ namespace Gecode { namespace Search { namespace Seq {
 
 
   forceinline void
-  Slave::init(Engine* e, Stop* s) {
-    slave = e; stop = s;
+  Slave::init(Engine* e, Stop* s, unsigned int i0, unsigned long int l0) {
+    slave = e; stop = s; i = i0; l = l0;
+    w = 1U; stall = 0U; progress = false; sol = false;
+  }
+  forceinline void
+  Slave::respawn(Engine* e) {
+    delete slave;
+    slave = e;
+    w = 1U; stall = 0U; progress = false; sol = false;
+  }
+  forceinline Stop*
+  Slave::stopper(void) const {
+    return stop;
+  }
+  forceinline unsigned long int
+  Slave::fail(void) const {
+    return slave->statistics().fail;
   }
   forceinline Space*
   Slave::next(void) {
@@ -76,57 +92,96 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline
   PBS<best>::PBS(Engine** e, Stop** s, unsigned int n,
                  const Statistics& stat0,
-                 const Search::Options& opt)
+                 const Search::Options& opt, Spawn* sp0)
     : stat(stat0), slice(opt.slice),
       slaves(heap.alloc<Slave>(n)), n_slaves(n), cur(0),
-      slave_stop(false) {
+      slave_stop(false), adaptive(opt.adaptive),
+      n_assets(n), as(heap.alloc<Statistics>(n)), n_spawned(0U),
+      sp(sp0), b(NULL) {
     ssi.done = false;
     ssi.l = opt.slice;
 
     for (unsigned int i=n; i--; ) {
-      slaves[i].init(e[i],static_cast<PortfolioStop*>(s[i]));
+      slaves[i].init(e[i],static_cast<PortfolioStop*>(s[i]),i,opt.slice);
       static_cast<PortfolioStop*>(s[i])->share(&ssi);
+      (void) new (&as[i]) Statistics;
+    }
+  }
+
+  template<bool best>
+  void
+  PBS<best>::schedule(unsigned int i) {
+    Slave& s = slaves[i];
+    if (adaptive) {
+      if (s.progress) {
+        s.w = std::min(2U*s.w,Config::pbs_weight);
+        s.stall = 0U; s.sol = true;
+      } else {
+        s.w = std::max(s.w/2U,1U);
+        s.stall++;
+      }
+      s.progress = false;
+      if ((sp != NULL) && (s.stall >= Config::pbs_stall)) {
+        // Respawn only if another asset has made progress recently
+        bool other = false;
+        for (unsigned int j=0; j<n_slaves; j++)
+          if ((j != i) && slaves[j].sol &&
+              (slaves[j].stall < Config::pbs_stall))
+            other = true;
+        if (other)
+          if (Engine* e = (*sp)(n_assets+n_spawned++,s.i,s.stopper())) {
+            if (b != NULL)
+              e->constrain(*b);
+            // Keep the statistics of the replaced engine
+            Statistics ss = s.statistics();
+            stat += ss;
+            as[s.i] += ss;
+            s.respawn(e);
+          }
+      }
     }
+    s.l = s.fail() + static_cast<unsigned long int>(slice) * s.w;
   }
 
   template<bool best>
   Space*
   PBS<best>::next(void) {
     slave_stop = false;
-    unsigned int n_exhausted = 0;
     while (n_slaves > 0) {
+      // Disable stopping by setting a high limit if only one slave is left
+      ssi.l = (n_slaves == 1) ? ULONG_MAX : slaves[cur].l;
       if (Space* s = slaves[cur].next()) {
+        slaves[cur].progress = true;
         // Constrain other slaves
         if (best) {
           for (unsigned int i=0; i<cur; i++)
             slaves[i].constrain(*s);
           for (unsigned int i=cur+1; i<n_slaves; i++)
             slaves[i].constrain(*s);
+          if (sp != NULL) {
+            delete b;
+            b = s->clone();
+          }
         }
         return s;
       }
       if (slaves[cur].stopped()) {
         if (ssi.done) {
-          cur++; n_exhausted++;
+          schedule(cur);
+          cur++;
         } else {
           slave_stop = true;
           return NULL;
         }
       } else {
         // This slave is done, kill it after saving the statistics
-        stat += slaves[cur].statistics();
+        Statistics ss = slaves[cur].statistics();
+        stat += ss;
+        as[slaves[cur].i] += ss;
         slaves[cur].~Slave();
         slaves[cur] = slaves[--n_slaves];
-        if (n_slaves == 1)
-          // Disable stoping by seeting a high limit
-          ssi.l = ULONG_MAX;
-      }
-      if (n_exhausted == n_slaves) {
-        n_exhausted = 0;
-        // Increment by one slice
-        ssi.l += slice;
       }
-      if (cur == n_slaves)
+      if (cur >= n_slaves)
         cur = 0;
     }
     return NULL;
@@ -149,11 +204,33 @@ namespace Gecode { namespace Search { namespace Seq {
 
   template<bool best>
   void
-  PBS<best>::constrain(const Space& b) {
+  PBS<best>::constrain(const Space& b0) {
     if (!best)
       throw NoBest("PBS::constrain");
     for (unsigned int i=0; i<n_slaves; i++)
-      slaves[i].constrain(b);
+      slaves[i].constrain(b0);
+    if (sp != NULL) {
+      delete b;
+      b = b0.clone();
+    }
+  }
+
+  template<bool best>
+  unsigned int
+  PBS<best>::assets(void) const {
+    return n_assets;
+  }
+
+  template<bool best>
+  Statistics
+  PBS<best>::asset(unsigned int a) const {
+    if (a >= n_assets)
+      return Statistics();
+    Statistics s(as[a]);
+    for (unsigned int i=n_slaves; i--; )
+      if (slaves[i].i == a)
+        s += slaves[i].statistics();
+    return s;
   }
 
   template<bool best>
@@ -162,6 +239,9 @@ namespace Gecode { namespace Search { namespace Seq {
       slaves[i].~Slave();
     // Note that n_slaves might be different now!
     heap.rfree(slaves);
+    heap.free<Statistics>(as,n_assets);
+    delete sp;
+    delete b;
   }
 
 }}}
@@ -52,14 +52,39 @@ namespace Gecode { namespace Search { namespace Seq {
     return false;
   }
 
+  void
+  StoreNoGoods::post(Space& home) const {
+    unsigned long int n = 0UL;
+    if (l != NULL) {
+      l->post(home);
+      n = l->ng();
+    }
+    n += s->post(home,t);
+    const_cast<StoreNoGoods*>(this)->ng(n);
+  }
+
+  NoGoods&
+  RBS::nogoods(void) {
+    NoGoods& ng = e->nogoods();
+    // Reset number of no-goods found
+    ng.ng(0);
+    if (sng.store() == NULL)
+      return ng;
+    if (best)
+      // No-goods depend on the current bound, post but do not record them
+      sng.local(&ng);
+    else
+      sng.store()->record(ng);
+    sng.ng(0);
+    return sng;
+  }
+
   Space*
   RBS::next(void) {
     if (restart) {
       restart = false;
       sslr++;
-      NoGoods& ng = e->nogoods();
-      // Reset number of no-goods found
-      ng.ng(0);
+      NoGoods& ng = nogoods();
       MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
       bool r = master->master(mi);
       stop->m_stat.nogood += ng.ng();
@@ -92,8 +117,7 @@ namespace Gecode { namespace Search { namespace Seq {
         // The engine must perform a true restart
         // The number of the restart has been incremented in the stop object
         sslr = 0;
-        NoGoods& ng = e->nogoods();
-        ng.ng(0);
+        NoGoods& ng = nogoods();
         MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
         (void) master->master(mi);
         stop->m_stat.nogood += ng.ng();
@@ -39,11 +39,13 @@
 namespace Gecode { namespace Search { namespace Seq {
 
   class RBS;
+  class LNS;
 
   /// %Stop-object for restart engine
   class GECODE_SEARCH_EXPORT RestartStop : public Stop {
     template<class,template<class>class> friend class ::Gecode::RBS;
     friend class ::Gecode::Search::Seq::RBS;
+    friend class ::Gecode::Search::Seq::LNS;
   private:
     /// The failure limit for the engine
     unsigned long int l;
@@ -68,6 +70,26 @@ namespace Gecode { namespace Search { namespace Seq {
     Statistics metastatistics(void) const;
   };
 
+  /// No-goods recorded in and posted from a no-good store
+  class GECODE_SEARCH_EXPORT StoreNoGoods : public NoGoods {
+  protected:
+    /// The store (possibly NULL)
+    NoGoodStore* s;
+    /// Stamp of the no-goods already posted
+    mutable unsigned long int t;
+    /// No-goods posted in addition but not recorded (possibly NULL)
+    const NoGoods* l;
+  public:
+    /// Initialize for store \a s
+    StoreNoGoods(NoGoodStore* s);
+    /// Return store
+    NoGoodStore* store(void) const;
+    /// Also post no-goods \a ng that are not recorded in the store
+    void local(const NoGoods* ng);
+    /// Post no-goods not yet posted
+    virtual void post(Space& home) const;
+  };
+
   /// Engine for restart-based search
   class GECODE_SEARCH_EXPORT RBS : public Engine {
   protected:
@@ -91,6 +113,10 @@ namespace Gecode { namespace Search { namespace Seq {
     bool restart;
     /// Whether the engine performs best solution search
     bool best;
+    /// No-goods from the no-good store
+    StoreNoGoods sng;
+    /// Return no-goods from the last restart
+    NoGoods& nogoods(void);
   public:
     /// Constructor
     RBS(Space* s, RestartStop* stop0, Engine* e0,
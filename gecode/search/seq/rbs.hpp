@@ -61,13 +61,29 @@ namespace Gecode { namespace Search { namespace Seq {
   }
 
 
+  forceinline
+  StoreNoGoods::StoreNoGoods(NoGoodStore* s0)
+    : s(s0), t(0UL), l(NULL) {}
+
+  forceinline NoGoodStore*
+  StoreNoGoods::store(void) const {
+    return s;
+  }
+
+  forceinline void
+  StoreNoGoods::local(const NoGoods* ng) {
+    l = ng;
+  }
+
+
   forceinline
   RBS::RBS(Space* s, RestartStop* stop0,
            Engine* e0, const Search::Statistics& stat, const Options& opt,
            bool best0)
     : e(e0), master(s), last(NULL), co(opt.cutoff), stop(stop0),
       sslr(0),
-      complete(true), restart(false), best(best0) {
+      complete(true), restart(false), best(best0),
+      sng(opt.nogoods_store) {
     stop->limit(stat,(*co)());
   }
 
@@ -39,12 +39,55 @@ namespace Gecode { namespace Search {
   Statistics::reset(void) {
     StatusStatistics::reset();
     fail=0; node=0; depth=0; restart=0; nogood=0;
+    steal=0; steal_fail=0; steal_remote=0;
+    clone=0; recompute=0; memory=0;
+    t_propagate=0.0; t_clone=0.0; t_recompute=0.0; t_steal=0.0; t_idle=0.0;
+    if (h != NULL)
+      for (unsigned int i=0; i<Config::fail_depth+Config::steal_worker; i++)
+        h[i]=0;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0), node(0), depth(0),
-      restart(0), nogood(0) {}
+      restart(0), nogood(0), steal(0), steal_fail(0), steal_remote(0),
+      clone(0), recompute(0), memory(0),
+      t_propagate(0.0), t_clone(0.0), t_recompute(0.0),
+      t_steal(0.0), t_idle(0.0), h(NULL) {}
+
+  forceinline
+  Statistics::Statistics(const Statistics& s)
+    : StatusStatistics(s), fail(s.fail), node(s.node), depth(s.depth),
+      restart(s.restart), nogood(s.nogood), steal(s.steal),
+      steal_fail(s.steal_fail), steal_remote(s.steal_remote),
+      clone(s.clone), recompute(s.recompute), memory(s.memory),
+      t_propagate(s.t_propagate), t_clone(s.t_clone),
+      t_recompute(s.t_recompute), t_steal(s.t_steal), t_idle(s.t_idle),
+      h(NULL) {
+    if (s.h != NULL) {
+      histograms(true);
+      for (unsigned int i=0; i<Config::fail_depth+Config::steal_worker; i++)
+        h[i] = s.h[i];
+    }
+  }
+
+  forceinline Statistics&
+  Statistics::operator =(const Statistics& s) {
+    if (&s != this) {
+      StatusStatistics::operator =(s);
+      fail=s.fail; node=s.node; depth=s.depth;
+      restart=s.restart; nogood=s.nogood;
+      steal=s.steal; steal_fail=s.steal_fail; steal_remote=s.steal_remote;
+      clone=s.clone; recompute=s.recompute; memory=s.memory;
+      t_propagate=s.t_propagate; t_clone=s.t_clone;
+      t_recompute=s.t_recompute; t_steal=s.t_steal; t_idle=s.t_idle;
+      histograms(s.h != NULL);
+      if (s.h != NULL)
+        for (unsigned int i=0; i<Config::fail_depth+Config::steal_worker; i++)
+          h[i] = s.h[i];
+    }
+    return *this;
+  }
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
@@ -54,6 +97,22 @@ namespace Gecode { namespace Search {
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    steal += s.steal;
+    steal_fail += s.steal_fail;
+    steal_remote += s.steal_remote;
+    clone += s.clone;
+    recompute += s.recompute;
+    memory = std::max(memory,s.memory);
+    t_propagate += s.t_propagate;
+    t_clone += s.t_clone;
+    t_recompute += s.t_recompute;
+    t_steal += s.t_steal;
+    t_idle += s.t_idle;
+    if (s.h != NULL) {
+      histograms(true);
+      for (unsigned int i=0; i<Config::fail_depth+Config::steal_worker; i++)
+        h[i] += s.h[i];
+    }
     return *this;
   }
 
@@ -63,6 +122,54 @@ namespace Gecode { namespace Search {
     return t += *this;
   }
 
+  forceinline void
+  Statistics::failure(unsigned long int d) {
+    fail++;
+    if (h != NULL)
+      h[std::min(d,static_cast<unsigned long int>(Config::fail_depth-1))]++;
+  }
+
+  forceinline void
+  Statistics::stolen(unsigned int i) {
+    if (h != NULL)
+      h[Config::fail_depth+std::min(i,Config::steal_worker-1)]++;
+  }
+
+  forceinline void
+  Statistics::histograms(bool b) {
+    if (b && (h == NULL)) {
+      h = heap.alloc<unsigned long int>(Config::fail_depth+
+                                        Config::steal_worker);
+      for (unsigned int i=0; i<Config::fail_depth+Config::steal_worker; i++)
+        h[i] = 0;
+    } else if (!b && (h != NULL)) {
+      heap.free<unsigned long int>(h,Config::fail_depth+
+                                   Config::steal_worker);
+      h = NULL;
+    }
+  }
+
+  forceinline bool
+  Statistics::histograms(void) const {
+    return h != NULL;
+  }
+
+  forceinline unsigned long int
+  Statistics::fail_depth(unsigned int d) const {
+    return (h != NULL) ? h[std::min(d,Config::fail_depth-1)] : 0UL;
+  }
+
+  forceinline unsigned long int
+  Statistics::steal_worker(unsigned int i) const {
+    return (h != NULL) ?
+      h[Config::fail_depth+std::min(i,Config::steal_worker-1)] : 0UL;
+  }
+
+  forceinline
+  Statistics::~Statistics(void) {
+    histograms(false);
+  }
+
 }}
 
 // STATISTICS: search-other
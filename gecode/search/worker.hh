@@ -47,9 +47,15 @@ namespace Gecode { namespace Search {
     bool _stopped;
     /// Depth of root node (for work stealing)
     unsigned long int root_depth;
+    /// Whether time is measured
+    bool _instrument;
   public:
     /// Initialize
     Worker(void);
+    /// Set whether time is measured
+    void instrument(bool i);
+    /// Test whether time is measured
+    bool instrument(void) const;
     /// Reset stop information
     void start(void);
     /// Check whether engine must be stopped
@@ -62,13 +68,45 @@ namespace Gecode { namespace Search {
     void stack_depth(unsigned long int d);
     /// Return steal depth
     unsigned long int steal_depth(unsigned long int d) const;
+    /// Record failure at stack depth \a d
+    void failure(unsigned long int d);
+  };
+
+  /**
+   * \brief Measurement of time for a worker
+   *
+   * The time between creation and destruction is added to a time
+   * of the worker statistics, provided the worker is instrumented.
+   */
+  class Measure {
+  protected:
+    /// Time to add to (NULL if not instrumented)
+    double* t;
+    /// Timer
+    Support::Timer timer;
+  public:
+    /// Start measuring time for worker \a w to be added to \a t0
+    Measure(const Worker& w, double& t0);
+    /// Stop measuring time
+    ~Measure(void);
   };
 
 
 
   forceinline
   Worker::Worker(void)
-    : _stopped(false), root_depth(0) {}
+    : _stopped(false), root_depth(0), _instrument(false) {}
+
+  forceinline void
+  Worker::instrument(bool i) {
+    _instrument = i;
+    histograms(i);
+  }
+
+  forceinline bool
+  Worker::instrument(void) const {
+    return _instrument;
+  }
 
   forceinline void
   Worker::start(void) {
@@ -107,6 +145,25 @@ namespace Gecode { namespace Search {
     return root_depth + d;
   }
 
+  forceinline void
+  Worker::failure(unsigned long int d) {
+    Statistics::failure(root_depth + d);
+  }
+
+
+  forceinline
+  Measure::Measure(const Worker& w, double& t0)
+    : t(w.instrument() ? &t0 : NULL) {
+    if (t != NULL)
+      timer.start();
+  }
+
+  forceinline
+  Measure::~Measure(void) {
+    if (t != NULL)
+      *t += timer.stop();
+  }
+
 }}
 
 #endif
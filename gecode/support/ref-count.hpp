@@ -49,6 +49,8 @@ namespace Gecode { namespace Support {
     bool dec(void);
     /// Test whether reference count is non-zero
     operator bool(void) const;
+    /// Test whether reference count is exactly one
+    bool unique(void) const;
   };
 
   forceinline
@@ -67,6 +69,10 @@ namespace Gecode { namespace Support {
   RefCount::operator bool(void) const {
     return n.load(std::memory_order_acquire) > 0U;
   }
+  forceinline bool
+  RefCount::unique(void) const {
+    return n.load(std::memory_order_acquire) == 1U;
+  }
 
 }}
 
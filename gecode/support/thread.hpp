@@ -336,6 +336,18 @@ namespace Gecode { namespace Support {
     static void sleep(unsigned int ms);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
+    /// Return number of NUMA nodes (1 if information not available)
+    GECODE_SUPPORT_EXPORT static unsigned int numa_nodes(void);
+    /**
+     * \brief Bind current thread to the processing units of NUMA node \a n
+     *
+     * Only processing units the thread is allowed to use are taken
+     * into account. Returns whether binding was successful. Binding is
+     * only supported on Linux.
+     */
+    GECODE_SUPPORT_EXPORT static bool numa_bind(unsigned int n);
+    /// Restore processing units of current thread from before binding
+    GECODE_SUPPORT_EXPORT static void numa_unbind(void);
   private:
     /// A thread cannot be copied
     Thread(const Thread&) {}
@@ -35,6 +35,11 @@
 
 #ifdef GECODE_THREADS_PTHREADS
 
+#ifdef __linux__
+#include <sched.h>
+#include <cstdio>
+#endif
+
 namespace Gecode { namespace Support {
 
   /// Function to start execution
@@ -55,6 +60,96 @@ namespace Gecode { namespace Support {
       throw OperatingSystemError("Thread::run[pthread_create]");
   }
 
+#ifdef __linux__
+
+  /// Set \a s to processing units of NUMA node \a n, return whether node exists
+  static bool
+  numa_cpus(unsigned int n, cpu_set_t& s) {
+    char fn[64];
+    snprintf(fn, sizeof(fn), "/sys/devices/system/node/node%u/cpulist", n);
+    FILE* f = fopen(fn,"r");
+    if (f == NULL)
+      return false;
+    CPU_ZERO(&s);
+    bool cpus = false;
+    // The list has the form "0-3,8,10-11"
+    unsigned int l;
+    while (fscanf(f,"%u",&l) == 1) {
+      unsigned int u = l;
+      int c = fgetc(f);
+      if ((c == '-') && (fscanf(f,"%u",&u) == 1))
+        c = fgetc(f);
+      for (unsigned int i=l; (i<=u) && (i<CPU_SETSIZE); i++) {
+        CPU_SET(i,&s); cpus = true;
+      }
+      if (c != ',')
+        break;
+    }
+    fclose(f);
+    return cpus;
+  }
+
+  unsigned int
+  Thread::numa_nodes(void) {
+    unsigned int n = 0;
+    cpu_set_t s;
+    while (numa_cpus(n,s))
+      n++;
+    return (n > 1) ? n : 1;
+  }
+
+  namespace {
+    /// Whether the current thread is bound to a NUMA node
+    thread_local bool numa_bound = false;
+    /// Processing units of the current thread before binding
+    thread_local cpu_set_t numa_saved;
+  }
+
+  bool
+  Thread::numa_bind(unsigned int n) {
+    cpu_set_t s;
+    if (!numa_cpus(n,s))
+      return false;
+    if (!numa_bound) {
+      if (pthread_getaffinity_np(pthread_self(),sizeof(numa_saved),
+                                 &numa_saved) != 0)
+        return false;
+    }
+    // Only use processing units the thread was allowed to use before
+    CPU_AND(&s,&s,&numa_saved);
+    if ((CPU_COUNT(&s) == 0) ||
+        (pthread_setaffinity_np(pthread_self(),sizeof(s),&s) != 0))
+      return false;
+    numa_bound = true;
+    return true;
+  }
+
+  void
+  Thread::numa_unbind(void) {
+    if (numa_bound) {
+      (void) pthread_setaffinity_np(pthread_self(),sizeof(numa_saved),
+                                    &numa_saved);
+      numa_bound = false;
+    }
+  }
+
+#else
+
+  unsigned int
+  Thread::numa_nodes(void) {
+    return 1;
+  }
+
+  bool
+  Thread::numa_bind(unsigned int) {
+    return false;
+  }
+
+  void
+  Thread::numa_unbind(void) {}
+
+#endif
+
 }}
 
 #endif
@@ -74,6 +74,23 @@ namespace Gecode { namespace Support {
     }
   }
 
+#ifndef GECODE_HAS_THREADS
+
+  unsigned int
+  Thread::numa_nodes(void) {
+    return 1;
+  }
+
+  bool
+  Thread::numa_bind(unsigned int) {
+    return false;
+  }
+
+  void
+  Thread::numa_unbind(void) {}
+
+#endif
+
 }}
 
 // STATISTICS: support-any
@@ -57,6 +57,19 @@ namespace Gecode { namespace Support {
       throw OperatingSystemError("Thread::run[Windows::CloseHandle]");
   }
 
+  unsigned int
+  Thread::numa_nodes(void) {
+    return 1;
+  }
+
+  bool
+  Thread::numa_bind(unsigned int) {
+    return false;
+  }
+
+  void
+  Thread::numa_unbind(void) {}
+
 }}
 
 #endif
@@ -134,6 +134,98 @@ namespace Test {
 
   AFC afc;
 
+#ifdef GECODE_HAS_THREADS
+
+  /// %Test for concurrent failure counting by several threads
+  class AFCThreads : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    protected:
+      /// Two integer variables
+      Gecode::IntVar x, y;
+    public:
+      /// Constructor for creation
+      TestSpace(void) : x(*this,0,10), y(*this,0,10) {
+        // Disequality only fails when both variables are assigned
+        Gecode::rel(*this, x, Gecode::IRT_NQ, y);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+        y.update(*this,s.y);
+      }
+      /// Make the disequality propagator fail
+      void fail(void) {
+        Gecode::rel(*this, x, Gecode::IRT_EQ, 5);
+        Gecode::rel(*this, y, Gecode::IRT_EQ, 5);
+        (void) status();
+      }
+      /// Return afc of variable \a x
+      double afc(void) const {
+        return x.afc();
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// Thread that repeatedly fails a clone of a space
+    class Failer : public Gecode::Support::Runnable {
+    protected:
+      /// Space to be cloned
+      TestSpace* s;
+      /// Event to signal termination
+      Gecode::Support::Event& e;
+    public:
+      /// Initialize
+      Failer(TestSpace* s0, Gecode::Support::Event& e0) : s(s0), e(e0) {}
+      /// Fail clones of the space
+      virtual void run(void) {
+        for (int i=n_fails; i--; ) {
+          TestSpace* c = static_cast<TestSpace*>(s->clone());
+          c->fail();
+          delete c;
+        }
+        e.signal();
+      }
+    };
+    /// Number of threads
+    static const int n_threads = 4;
+    /// Number of failures per thread
+    static const int n_fails = 4 * 1024;
+  public:
+    /// Initialize test
+    AFCThreads(void) : Test::Base("AFC::Threads") {}
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* s = new TestSpace;
+      (void) s->status();
+      TestSpace* c[n_threads];
+      Gecode::Support::Event e[n_threads];
+      // Clone in the main thread as cloning updates the original space
+      for (int i=0; i<n_threads; i++)
+        c[i] = static_cast<TestSpace*>(s->clone());
+      for (int i=0; i<n_threads; i++)
+        Gecode::Support::Thread::run(new Failer(c[i],e[i]));
+      for (int i=0; i<n_threads; i++) {
+        e[i].wait();
+        delete c[i];
+      }
+      // No failure must be lost as the decay factor is one
+      bool ok = (s->afc() == 1.0 + n_threads * n_fails);
+      if (!ok)
+        olog << ind(1) << "Expected afc: " << 1.0 + n_threads * n_fails
+             << ", found: " << s->afc() << std::endl;
+      delete s;
+      return ok;
+    }
+  };
+
+  AFCThreads afc_threads;
+
+#endif
+
 }
 
 // STATISTICS: test-core
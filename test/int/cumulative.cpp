@@ -34,6 +34,9 @@
 #include "test/int.hh"
 
 #include <gecode/minimodel.hh>
+#include <gecode/search.hh>
+
+#include <vector>
 
 namespace Test { namespace Int {
 
@@ -484,6 +487,161 @@ namespace Test { namespace Int {
       }
     };
 
+    /// Generated instance of a resource-constrained project scheduling problem
+    class RCPSPInstance {
+    public:
+      /// Number of activities
+      int n;
+      /// Number of resources
+      int m;
+      /// Processing times of activities
+      Gecode::IntArgs p;
+      /// Usage of resources by activities (activity-major)
+      Gecode::IntArgs u;
+      /// Capacities of resources
+      Gecode::IntArgs c;
+      /// Precedences: activity \a a[2*i] must end before \a a[2*i+1] starts
+      Gecode::IntArgs a;
+      /// Generate instance with \a n0 activities and \a m0 resources
+      RCPSPInstance(int n0, int m0)
+        : n(n0), m(m0), p(n0), u(n0*m0), c(m0) {
+        for (int r=0; r<m; r++)
+          c[r] = 4 + static_cast<int>(Base::rand(4));
+        for (int i=0; i<n; i++) {
+          p[i] = 1 + static_cast<int>(Base::rand(4));
+          for (int r=0; r<m; r++)
+            u[i*m+r] = static_cast<int>(Base::rand(static_cast<unsigned int>(c[r])));
+          // Each activity has at most two predecessors among the earlier ones
+          for (int k=0; (i > 0) && (k < 2); k++)
+            if (Base::rand(3) == 0)
+              a << static_cast<int>(Base::rand(static_cast<unsigned int>(i)))
+                << i;
+        }
+      }
+      /// Return sum of processing times (a trivial horizon)
+      int horizon(void) const {
+        int h = 0;
+        for (int i=n; i--; )
+          h += p[i];
+        return h;
+      }
+      /// Test whether start times \a s are a solution
+      template<class Starts>
+      bool solution(const Starts& s) const {
+        for (int i=0; i<a.size(); i+=2)
+          if (s[a[i]] + p[a[i]] > s[a[i+1]])
+            return false;
+        int t = 0;
+        for (int i=0; i<n; i++)
+          t = std::max(t,s[i]+p[i]);
+        for (int r=0; r<m; r++) {
+          std::vector<int> used(t,0);
+          for (int i=0; i<n; i++)
+            for (int j=s[i]; j<s[i]+p[i]; j++)
+              used[j] += u[i*m+r];
+          for (int j=0; j<t; j++)
+            if (used[j] > c[r])
+              return false;
+        }
+        return true;
+      }
+      /// Post constraints on start times \a s
+      void post(Gecode::Space& home, const Gecode::IntVarArgs& s,
+                Gecode::IntPropLevel ipl) const {
+        using namespace Gecode;
+        for (int i=0; i<a.size(); i+=2)
+          rel(home, s[a[i]] + p[a[i]] <= s[a[i+1]]);
+        for (int r=0; r<m; r++) {
+          IntArgs ur(n);
+          for (int i=0; i<n; i++)
+            ur[i] = u[i*m+r];
+          cumulative(home, c[r], s, p, ur, ipl);
+        }
+      }
+    };
+
+    /// Test for generated resource-constrained project scheduling problems
+    class RCPSP : public Test {
+    protected:
+      /// The instance
+      RCPSPInstance i;
+    public:
+      /// Create and register test
+      RCPSP(int k, int n, Gecode::IntPropLevel ipl0)
+        : Test("Cumulative::RCPSP::"+str(k)+"::"+str(ipl0),
+               n,0,7,false,ipl0), i(n,2) {
+        testsearch = false;
+        testfix = false;
+        contest = CTL_NONE;
+      }
+      /// Create and register initial assignment
+      virtual Assignment* assignment(void) const {
+        return new RandomAssignment(arity,dom,500);
+      }
+      /// Test whether \a x is solution
+      virtual bool solution(const Assignment& x) const {
+        return i.solution(x);
+      }
+      /// Post constraint on \a x
+      virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+        i.post(home, x, ipl);
+      }
+    };
+
+    /**
+     * \brief Test for large generated resource-constrained project scheduling problems
+     *
+     * Finds the first schedule for many activities where each
+     * cumulative constraint is propagated many times while only few
+     * activities change. The test also serves as a benchmark for
+     * time-tabling (run it with -test Int::Cumulative::RCPSP::Large).
+     */
+    class RCPSPLarge : public Base {
+    protected:
+      /// The instance
+      RCPSPInstance i;
+      /// Consistency level
+      Gecode::IntPropLevel ipl;
+      /// %Test space
+      class TestSpace : public Gecode::Space {
+      public:
+        /// Start times
+        Gecode::IntVarArray s;
+        /// Constructor
+        TestSpace(int n, int h) : s(*this,n,0,h) {}
+        /// Constructor for cloning \a ts
+        TestSpace(TestSpace& ts) : Gecode::Space(ts) {
+          s.update(*this,ts.s);
+        }
+        /// Copy space during cloning
+        virtual Gecode::Space* copy(void) {
+          return new TestSpace(*this);
+        }
+      };
+    public:
+      /// Create and register test
+      RCPSPLarge(int n, Gecode::IntPropLevel ipl0)
+        : Base("Int::Cumulative::RCPSP::Large::"+
+               Test::str(n)+"::"+Test::str(ipl0)), i(n,4), ipl(ipl0) {}
+      /// Perform test
+      virtual bool run(void) {
+        using namespace Gecode;
+        TestSpace* ts = new TestSpace(i.n,i.horizon());
+        i.post(*ts, ts->s, ipl);
+        branch(*ts, ts->s, INT_VAR_MIN_MIN(), INT_VAL_MIN());
+        DFS<TestSpace> e(ts);
+        delete ts;
+        TestSpace* s = e.next();
+        if (s == NULL)
+          return false;
+        std::vector<int> x(i.n);
+        for (int k=0; k<i.n; k++)
+          x[k] = s->s[k].val();
+        delete s;
+        return i.solution(x);
+      }
+    };
+
     /// Help class to create and register tests
     class Create {
     public:
@@ -503,6 +661,11 @@ namespace Test { namespace Int {
         IntArgs u5(3, 1,3,2);
 
         for (IntPropBasicAdvanced ipba; ipba(); ++ipba) {
+          for (int k=0; k<4; k++)
+            (void) new RCPSP(k,5,ipba.ipl());
+          (void) new RCPSPLarge(200,ipba.ipl());
+          (void) new RCPSPLarge(1000,ipba.ipl());
+
           // Regression test: check correct detection of disjunctive case
           (void) new ManFixPCumulative(3,p5,u5,0,ipba.ipl());
 
@@ -437,14 +437,23 @@ namespace Test { namespace Int {
        Gecode::TupleSet ts;
        /// Whether to validate dfa2tupleset
        bool toDFA;
+       /// The MDD of the tuple set to post (if any)
+       Gecode::MDD* mdd;
      public:
        /// Create and register test
        TupleSetTest(const std::string& s,
-                    Gecode::IntSet d0, Gecode::TupleSet ts0, bool td)
-         : Test("Extensional::TupleSet::"+s,
-                ts0.arity(),d0,false,Gecode::IPL_DOM), ts(ts0) {
+                    Gecode::IntSet d0, Gecode::TupleSet ts0, bool td,
+                    bool tm=false)
+         : Test(std::string(tm ? "Extensional::MDD::" :
+                            "Extensional::TupleSet::")+s,
+                ts0.arity(),d0,false,Gecode::IPL_DOM), ts(ts0),
+           mdd(tm ? new Gecode::MDD(ts0) : NULL) {
          toDFA = td;
        }
+       /// Delete MDD
+       virtual ~TupleSetTest(void) {
+         delete mdd;
+       }
        /// %Test whether \a x is solution
        virtual bool solution(const Assignment& x) const {
          using namespace Gecode;
@@ -457,6 +466,15 @@ namespace Test { namespace Int {
            if (same)
              return true;
          }
+         // Wildcards are stored as the full range of values
+         for (int i=ts.compressed(); i--; ) {
+           bool match = true;
+           for (int j=0; (j < ts.arity()) && match; j++)
+             if ((x[j] < ts.lower(i)[j]) || (x[j] > ts.upper(i)[j]))
+               match = false;
+           if (match)
+             return true;
+         }
          return false;
        }
        /// Post constraint on \a x
@@ -467,7 +485,10 @@ namespace Test { namespace Int {
            TupleSet t = TupleSet(ts.arity(),tupleset2dfa(ts));
            assert(ts == t);
          }
-         extensional(home, x, ts, ipl);
+         if (mdd != NULL)
+           extensional(home, x, *mdd, ipl);
+         else
+           extensional(home, x, ts, ipl);
        }
      };
 
@@ -475,8 +496,9 @@ namespace Test { namespace Int {
      public:
        /// Create and register test
        RandomTupleSetTest(const std::string& s,
-                          Gecode::IntSet d0, Gecode::TupleSet ts0)
-         : TupleSetTest(s,d0,ts0,false) {
+                          Gecode::IntSet d0, Gecode::TupleSet ts0,
+                          bool tm=false)
+         : TupleSetTest(s,d0,ts0,false,tm) {
          testsearch = false;
        }
        /// Create and register initial assignment
@@ -569,6 +591,109 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with MDD for words of fixed length of a DFA
+     class MDDDFA : public Test {
+     public:
+       /// Create and register test
+       MDDDFA(void)
+         : Test("Extensional::MDD::DFA",5,0,2,false,Gecode::IPL_DOM) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int s = 0;
+         for (int i=0; i<x.size(); i++) {
+           if ((i > 0) && (x[i-1] == 2) && (x[i] == 2))
+             return false;
+           s += x[i];
+         }
+         return (s % 3) == 0;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         // State 2*m+l: sum is m modulo 3, l whether last value is 2
+         DFA::Transition t[16];
+         int k = 0;
+         for (int m=0; m<3; m++)
+           for (int l=0; l<2; l++)
+             for (int v=0; v<=2; v++)
+               if ((l == 0) || (v != 2)) {
+                 t[k].i_state = 2*m+l;
+                 t[k].symbol  = v;
+                 t[k].o_state = 2*((m+v) % 3)+((v == 2) ? 1 : 0);
+                 k++;
+               }
+         t[k].i_state = -1;
+         int f[] = {0, 1, -1};
+         DFA d(0, t, f);
+         MDD m(d, x.size());
+         assert(m.nodes(x.size()) == 1);
+         extensional(home, x, m, ipl);
+       }
+     };
+
+     /// %Test with Boolean MDD
+     class MDDBool : public Test {
+     public:
+       /// Create and register test
+       MDDBool(void)
+         : Test("Extensional::MDD::Bool",6,0,1,false) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int n = 0;
+         for (int i=0; i<x.size(); i++)
+           if (x[i] == 1) {
+             if ((i > 0) && (x[i-1] == 1))
+               return false;
+             n++;
+           }
+         return n > 0;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         BoolVarArgs y(x.size());
+         for (int i = x.size(); i--; )
+           y[i] = channel(home, x[i]);
+         REG r = *REG(0) + REG(1) + *(+REG(0) + REG(1)) + *REG(0);
+         extensional(home, y, MDD(DFA(r), x.size()), ipl);
+       }
+     };
+
+     /// %Test sharing and eviction of the extensional cache
+     class ExtensionalCacheTest : public Base {
+     public:
+       /// Create and register test
+       ExtensionalCacheTest(void) : Base("Int::Extensional::Cache") {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         {
+           TupleSet a(2), b(2);
+           a.add(0, 1).add(1, 2).add(-7, 5).finalize();
+           b.add(1, 2).add(-7, 5).add(0, 1).add(0, 1);
+           TupleSet ia = ExtensionalCache::intern(a);
+           TupleSet ib = ExtensionalCache::intern(b);
+           // The cached copy of a is returned without finalizing b
+           if (!(ia == ib) || !ib.finalized() || b.finalized())
+             return false;
+           REG r = REG(-7) + REG(5);
+           DFA d(r), e(r);
+           DFA id = ExtensionalCache::intern(d);
+           DFA ie = ExtensionalCache::intern(e);
+           if (!(id == ie))
+             return false;
+         }
+         // Nothing refers to the entries anymore
+         unsigned long int n_ts = ExtensionalCache::tuplesets();
+         unsigned long int n_dfa = ExtensionalCache::dfas();
+         ExtensionalCache::evict();
+         if ((ExtensionalCache::tuplesets() >= n_ts) ||
+             (ExtensionalCache::dfas() >= n_dfa))
+           return false;
+         return true;
+       }
+     };
+
      /// Help class to create and register tests with a fixed table size
      class TupleSetTestSize {
      public:
@@ -631,11 +756,13 @@ namespace Test { namespace Int {
              .add(1, 5, 2, 5).add(5, 3, 3, 2)
              .finalize();
            (void) new TupleSetTest("A",IntSet(0,6),ts,true);
+           (void) new TupleSetTest("A",IntSet(0,6),ts,false,true);
          }
          {
            TupleSet ts(4);
            ts.finalize();
            (void) new TupleSetTest("Empty",IntSet(1,2),ts,true);
+           (void) new TupleSetTest("Empty",IntSet(1,2),ts,false,true);
          }
          {
            TupleSet ts(4);
@@ -648,6 +775,7 @@ namespace Test { namespace Int {
            TupleSet ts(1);
            ts.add(1).add(2).add(3).finalize();
            (void) new TupleSetTest("Single",IntSet(-4,4),ts,true);
+           (void) new TupleSetTest("Single",IntSet(-4,4),ts,false,true);
          }
          {
            int m = Gecode::Int::Limits::min;
@@ -677,6 +805,9 @@ namespace Test { namespace Int {
            (void) new TupleSetTest("MinMax",
                                    IntSet(IntArgs(6, m,m+1,m+4,M-3,M-2,M)),
                                    ts,true);
+           (void) new TupleSetTest("MinMax",
+                                   IntSet(IntArgs(6, m,m+1,m+4,M-3,M-2,M)),
+                                   ts,false,true);
          }
          {
            TupleSet ts(7);
@@ -689,6 +820,7 @@ namespace Test { namespace Int {
            }
            ts.finalize();
            (void) new RandomTupleSetTest("Triangle",IntSet(0,6),ts);
+           (void) new RandomTupleSetTest("Triangle",IntSet(0,6),ts,true);
          }
          {
            for (int i = 0; i <= 64*6; i+=32)
@@ -699,6 +831,78 @@ namespace Test { namespace Int {
                                          randomTupleSet(10,-1,2,0.05));
            (void) new RandomTupleSetTest("Rand(5,-10,10)", IntSet(-10,10),
                                          randomTupleSet(5,-10,10,0.05));
+           (void) new RandomTupleSetTest("Rand(5,-10,10)", IntSet(-10,10),
+                                         randomTupleSet(5,-10,10,0.05),true);
+         }
+         {
+           // Tables with many words (dense and sparse layout of bit sets)
+           (void) new RandomTupleSetTest("Dense(5,0,6)", IntSet(0,6),
+                                         randomTupleSet(5,0,6,0.5));
+           (void) new RandomTupleSetTest("Dense(4,0,9)", IntSet(0,9),
+                                         randomTupleSet(4,0,9,0.9));
+         }
+         {
+           // Equal tuple sets shared through the cache
+           TupleSet a(3), b(3);
+           a.add(0, 1, 2).add(2, 1, 0).add(1, 4, 3).add(3, 3, 3);
+           b.add(3, 3, 3).add(1, 4, 3).add(0, 1, 2).add(2, 1, 0)
+             .add(0, 1, 2);
+           a.finalize();
+           (void) ExtensionalCache::intern(a);
+           TupleSet ib = ExtensionalCache::intern(b);
+           (void) new TupleSetTest("Interned",IntSet(-1,4),ib,true);
+         }
+         {
+           // Compressed tuples with wildcards only
+           int s = TupleSet::star;
+           TupleSet ts(4);
+           ts.add(1, 3, 2, 3).add(2, 1, 2, 4)
+             .add(s, 3, s, 2).add(0, s, 4, s)
+             .add(4, 4, s, 1).add(s, s, s, 0)
+             .add(3, 0, 1, 4).add(3, 0, 1, s)
+             .finalize();
+           (void) new TupleSetTest("Star",IntSet(-1,5),ts,false);
+           (void) new TupleSetTest("Star",IntSet(-1,5),ts,false,true);
+         }
+         {
+           // Compressed tuples with ranges and wildcards
+           int s = TupleSet::star;
+           TupleSet ts(4);
+           ts.add(2, 1, 2, 4).add(4, 0, 5, 1)
+             .add(IntArgs(4, 0, 2, s, 1), IntArgs(4, 1, 3, s, 3))
+             .add(IntArgs(4, s, 4, 1, 2), IntArgs(4, s, 4, 3, 2))
+             .add(IntArgs(4, 3, 3, 3, 3), IntArgs(4, 3, 3, 3, 3))
+             .add(IntArgs(4, 5, 1, 0, s), IntArgs(4, 2, 1, 0, s))
+             .finalize();
+           (void) new TupleSetTest("Range",IntSet(-1,6),ts,false);
+           (void) new TupleSetTest("Range",IntSet(-1,6),ts,false,true);
+         }
+         {
+           // Compressed tuples with a position only having wildcards
+           int s = TupleSet::star;
+           TupleSet ts(3);
+           ts.add(1, s, 2).add(s, s, 0).add(2, s, s).add(0, s, 1)
+             .finalize();
+           (void) new TupleSetTest("Wild",IntSet(-1,3),ts,false);
+           (void) new TupleSetTest("Wild",IntSet(-1,3),ts,false,true);
+         }
+         {
+           // Many compressed tuples
+           int s = TupleSet::star;
+           TupleSet ts(5);
+           for (int i = 0; i < 2000; i++) {
+             IntArgs l(5), u(5);
+             for (int j = 0; j < 5; j++) {
+               l[j] = Base::rand(7);
+               u[j] = (Base::rand(3) == 0) ? l[j] + Base::rand(3) : l[j];
+               if (Base::rand(4) == 0)
+                 l[j] = s;
+             }
+             ts.add(l,u);
+           }
+           ts.finalize();
+           (void) new RandomTupleSetTest("Compressed",IntSet(0,9),ts);
+           (void) new RandomTupleSetTest("Compressed",IntSet(0,9),ts,true);
          }
          {
            TupleSet t(5);
@@ -780,6 +984,11 @@ namespace Test { namespace Int {
      TupleSetLarge tsl(0.05);
 
      TupleSetBool tsbool(0.3);
+
+     ExtensionalCacheTest ect;
+
+     MDDDFA mdddfa;
+     MDDBool mddbool;
      //@}
 
    }
@@ -0,0 +1,207 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// Tests for memory management
+  namespace Memory {
+
+    /// Space with sufficiently many variables to use several heap chunks
+    class TestSpace : public Gecode::Space {
+    protected:
+      /// Integer variables
+      Gecode::IntVarArray x;
+    public:
+      /// Constructor for creation with \a n variables
+      TestSpace(int n) : x(*this,n,0,n) {
+        Gecode::distinct(*this, x);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+
+    /// %Test for reusing heap chunks from the thread-local cache
+    class ChunkCache : public Test::Base {
+    protected:
+      /// How often to clone
+      static const int n_clones = 64;
+    public:
+      /// Initialize test
+      ChunkCache(void) : Test::Base("Memory::ChunkCache") {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode::Kernel;
+        SharedMemory::Statistics b = SharedMemory::statistics();
+        TestSpace* s = new TestSpace(1024);
+        (void) s->status();
+        for (int i=n_clones; i--; )
+          delete s->clone();
+        delete s;
+        SharedMemory::Statistics a = SharedMemory::statistics();
+        if (a.local <= b.local) {
+          olog << ind(1) << "No heap chunk reused from thread-local cache"
+               << std::endl;
+          return false;
+        }
+        if ((a.allocated < b.allocated) || (a.released < b.released) ||
+            (a.shared < b.shared)) {
+          olog << ind(1) << "Statistics not monotonic" << std::endl;
+          return false;
+        }
+        return true;
+      }
+    };
+
+    ChunkCache chunk_cache;
+
+    /**
+     * \brief %Test that cloning a large space requests few heap chunks
+     *
+     * Uses the large memory policy as the heap chunk for a clone does
+     * not exceed the maximal chunk size.
+     */
+    class BulkClone : public Test::Base {
+    protected:
+      /// Number of variables in the space
+      static const int n_vars = 16 * 1024;
+      /// Return number of heap chunk requests so far
+      static unsigned long int requests(void) {
+        Gecode::Kernel::SharedMemory::Statistics s =
+          Gecode::Kernel::SharedMemory::statistics();
+        return s.local + s.shared + s.allocated;
+      }
+    public:
+      /// Initialize test
+      BulkClone(void) : Test::Base("Memory::BulkClone") {}
+      /// Perform actual tests
+      bool run(void) {
+        TestSpace* s = new TestSpace(n_vars);
+        s->memory_policy(Gecode::MemoryPolicy::large());
+        (void) s->status();
+        Gecode::Space* c = s->clone();
+        unsigned long int n = requests();
+        Gecode::Space* d = c->clone();
+        n = requests() - n;
+        delete d; delete c; delete s;
+        if (n > 2UL) {
+          olog << ind(1) << "Heap chunks requested for clone: " << n
+               << std::endl;
+          return false;
+        }
+        return true;
+      }
+    };
+
+    BulkClone bulk_clone;
+
+    /**
+     * \brief %Test for cloning with a memory policy
+     *
+     * When run with logging, the time for cloning is reported.
+     */
+    class Policy : public Test::Base {
+    protected:
+      /// The memory policy to use
+      Gecode::MemoryPolicy mp;
+      /// How often to clone
+      static const int n_clones = 32;
+      /// Number of variables in the space
+      static const int n_vars = 32 * 1024;
+    public:
+      /// Initialize test
+      Policy(const std::string& s, const Gecode::MemoryPolicy& mp0)
+        : Test::Base("Memory::Policy::"+s), mp(mp0) {}
+      /// Perform actual tests
+      bool run(void) {
+        TestSpace* s = new TestSpace(n_vars);
+        s->memory_policy(mp);
+        (void) s->status();
+        Gecode::Support::Timer t;
+        t.start();
+        for (int i=n_clones; i--; ) {
+          Gecode::Space* c = s->clone();
+          if (c->memory_policy().hcsz_max() != mp.hcsz_max()) {
+            olog << ind(1) << "Memory policy not shared by clone"
+                 << std::endl;
+            delete c; delete s;
+            return false;
+          }
+          delete c;
+        }
+        olog << ind(1) << "Time per clone: "
+             << t.stop() / n_clones << " ms" << std::endl;
+        delete s;
+        return true;
+      }
+    };
+
+    Policy policy_default("Default",Gecode::MemoryPolicy());
+    Policy policy_large("Large",Gecode::MemoryPolicy::large());
+
+    /// %Test that illegal memory policies are rejected
+    class IllegalPolicy : public Test::Base {
+    public:
+      /// Initialize test
+      IllegalPolicy(void) : Test::Base("Memory::Policy::Illegal") {}
+      /// Perform actual tests
+      bool run(void) {
+        try {
+          Gecode::MemoryPolicy mp(64 * 1024, 32 * 1024);
+          return false;
+        } catch (Gecode::IllegalMemoryPolicy&) {}
+        try {
+          Gecode::MemoryPolicy mp(64 * 1024, 64 * 1024, 0U);
+          return false;
+        } catch (Gecode::IllegalMemoryPolicy&) {}
+        return true;
+      }
+    };
+
+    IllegalPolicy illegal_policy;
+
+  }
+
+}
+
+// STATISTICS: test-core
@@ -34,6 +34,9 @@
 #include <gecode/minimodel.hh>
 #include <gecode/search.hh>
 
+#include <cstdio>
+#include <cstdlib>
+
 #include "test/test.hh"
 
 namespace Test {
@@ -308,6 +311,59 @@ namespace Test {
       }
     };
 
+    /// %Model with a weighted sum as objective
+    template<class Optimize>
+    class HasObjective : public Optimize {
+    public:
+      /// Variables used
+      IntVarArray x;
+      /// Cost variable
+      IntVar c;
+      /// Constructor for space creation
+      HasObjective(void)
+        : x(*this,6,0,5), c(*this,-100,100) {
+        distinct(*this, x);
+        IntArgs w(6, 3,-2,5,-1,4,2);
+        linear(*this, w, x, IRT_EQ, c);
+        branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      HasObjective(HasObjective& s) : Optimize(s) {
+        x.update(*this, s.x);
+        c.update(*this, s.c);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new HasObjective(*this);
+      }
+      /// Return cost
+      virtual IntVar cost(void) const {
+        return c;
+      }
+    };
+
+    /// %Model placing pigeons into holes
+    class Pigeons : public Space {
+    public:
+      /// Holes of pigeons
+      IntVarArray x;
+      /// Constructor for \a p pigeons and \a h holes
+      Pigeons(int p, int h) : x(*this,p,0,h-1) {
+        for (int i=0; i<p; i++)
+          for (int j=i+1; j<p; j++)
+            rel(*this, x[i], IRT_NQ, x[j]);
+        branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      Pigeons(Pigeons& s) : Space(s) {
+        x.update(*this, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Pigeons(*this);
+      }
+    };
+
     /// %Base class for search tests
     class Test : public Base {
     public:
@@ -480,17 +536,79 @@ namespace Test {
       }
     };
 
+    /// %Test for embarrassingly parallel search
+    template<class Model>
+    class EPS : public Test {
+    private:
+      /// Number of subproblems
+      unsigned int n;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      EPS(HowToConstrain htc,
+          HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int n0, unsigned int t0)
+        : Test("EPS::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(n0)+"::"+str(t0),
+               htb1,htb2,htb3,htc), n(n0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.subproblems = n;
+        o.stop = &f;
+        if (htc == HTC_NONE) {
+          Gecode::EPS<Model,Gecode::DFS> eps(m,o);
+          int s = m->solutions();
+          delete m;
+          while (true) {
+            Model* a = eps.next();
+            if (a != NULL) {
+              s--; delete a;
+            }
+            if ((a == NULL) && !eps.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+          return s == 0;
+        } else {
+          Gecode::EPS<Model,Gecode::BAB> eps(m,o);
+          delete m;
+          Model* b = NULL;
+          while (true) {
+            Model* a = eps.next();
+            if (a != NULL) {
+              delete b; b=a;
+            }
+            if ((a == NULL) && !eps.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+          bool ok = (b == NULL) || b->best();
+          delete b;
+          return ok;
+        }
+      }
+    };
+
     /// %Test for restart-based search
     template<class Model, template<class> class Engine>
     class RBS : public Test {
     private:
       /// Number of threads
       unsigned int t;
+      /// Whether threads restart independently
+      bool i;
     public:
       /// Initialize test
-      RBS(const std::string& e, unsigned int t0)
-        : Test("RBS::"+e+"::"+Model::name()+"::"+str(t0),
-               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0) {}
+      RBS(const std::string& e, unsigned int t0, bool i0=false)
+        : Test("RBS::"+e+"::"+Model::name()+"::"+str(t0)+
+               (i0 ? "::Independent" : ""),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0), i(i0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -499,20 +617,63 @@ namespace Test {
         o.threads = t;
         o.stop = &f;
         o.d_l = 100;
+        o.independent = i;
         o.cutoff = Gecode::Search::Cutoff::geometric(1,2);
         Gecode::RBS<Model,Engine> rbs(m,o);
-        int n = m->solutions();
+        int sols = m->solutions();
+        int n = 0;
         delete m;
         while (true) {
           Model* s = rbs.next();
           if (s != NULL) {
-            n--; delete s;
+            n++; delete s;
           }
           if ((s == NULL) && !rbs.stopped())
             break;
           f.limit(f.limit()+2);
         }
-        return n == 0;
+        if (!i || (t == 1))
+          return n == sols;
+        // Several threads might find the same solutions
+        return (n <= static_cast<int>(t)*sols) && ((n == 0) == (sols == 0));
+      }
+    };
+
+    /// %Test that independent restarts require a cutoff that can be copied
+    class UncopiableCutoff : public Test {
+    protected:
+      /// Cutoff generator that cannot be copied
+      class Cutoff : public Gecode::Search::Cutoff {
+      public:
+        /// Return the current cutoff value
+        virtual unsigned long int operator ()(void) const {
+          return 1UL;
+        }
+        /// Increment and return the next cutoff value
+        virtual unsigned long int operator ++(void) {
+          return 1UL;
+        }
+      };
+    public:
+      /// Initialize test
+      UncopiableCutoff(void)
+        : Test("RBS::UncopiableCutoff",HTB_BINARY,HTB_BINARY,HTB_BINARY) {}
+      /// Run test
+      virtual bool run(void) {
+        HasSolutions* m = new HasSolutions(htb1,htb2,htb3);
+        Cutoff c;
+        Gecode::Search::Options o;
+        o.threads = 2;
+        o.independent = true;
+        o.cutoff = &c;
+        bool ok = false;
+        try {
+          Gecode::RBS<HasSolutions,Gecode::DFS> rbs(m,o);
+        } catch (Gecode::Search::UncopiableCutoff&) {
+          ok = true;
+        }
+        delete m;
+        return ok;
       }
     };
 
@@ -526,11 +687,27 @@ namespace Test {
       unsigned int a;
       /// Number of threads
       unsigned int t;
+      /// Whether the portfolio is adaptive
+      bool ad;
+      /// Check that the statistics of all assets add up
+      bool assets(const Gecode::PBS<Model,Engine>& pbs) const {
+        // No portfolio is used for a single asset or a failed space
+        if ((pbs.assets() != 0) &&
+            (pbs.assets() != ((t > 1) ? std::min(a,t) : a)))
+          return false;
+        unsigned long int f = 0;
+        for (unsigned int i=0; i<pbs.assets(); i++)
+          f += pbs.asset(i).fail;
+        return f <= pbs.statistics().fail;
+      }
     public:
       /// Initialize test
-      PBS(const std::string& e, bool b, unsigned int a0, unsigned int t0)
-        : Test("PBS::"+e+"::"+Model::name()+"::"+str(a0)+"::"+str(t0),
-               HTB_BINARY,HTB_BINARY,HTB_BINARY), best(b), a(a0), t(t0) {}
+      PBS(const std::string& e, bool b, unsigned int a0, unsigned int t0,
+          bool ad0=false)
+        : Test("PBS::"+e+"::"+Model::name()+"::"+str(a0)+"::"+str(t0)+
+               (ad0 ? "::Adaptive" : ""),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY),
+          best(b), a(a0), t(t0), ad(ad0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -540,6 +717,11 @@ namespace Test {
         o.threads = t;
         o.d_l = 100;
         o.stop = &f;
+        if (ad) {
+          // Use small slices such that assets are rescheduled often
+          o.adaptive = true;
+          o.slice = 1;
+        }
         Gecode::PBS<Model,Engine> pbs(m,o);
         if (best) {
           Model* b = NULL;
@@ -552,7 +734,7 @@ namespace Test {
               break;
             f.limit(f.limit()+2);
           }
-          bool ok = (b == NULL) || b->best();
+          bool ok = ((b == NULL) || b->best()) && assets(pbs);
           delete b;
           return ok;
         } else {
@@ -567,7 +749,7 @@ namespace Test {
               break;
             f.limit(f.limit()+2);
           }
-          return n >= 0;
+          return (n >= 0) && assets(pbs);
         }
       }
     };
@@ -647,6 +829,745 @@ namespace Test {
       }
     };
 
+    /// %Model where all but the first asset of a portfolio never succeed
+    class Stalling : public HasObjective<IntMinimizeSpace> {
+    public:
+      /// Variables that cannot be assigned for all but the first asset
+      IntVarArray y;
+      /// Largest asset number a slave has been created for
+      static unsigned int a_max;
+      /// Constructor for space creation
+      Stalling(void) : y(*this,4,0,2) {}
+      /// Constructor for cloning \a s
+      Stalling(Stalling& s) : HasObjective<IntMinimizeSpace>(s) {
+        y.update(*this, s.y);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Stalling(*this);
+      }
+      /// Keep the brancher for all assets
+      virtual bool master(const MetaInfo& mi) {
+        if (mi.type() == MetaInfo::PORTFOLIO)
+          // Do not kill the brancher!
+          return true;
+        return HasObjective<IntMinimizeSpace>::master(mi);
+      }
+      /// Make all but the first asset fail on each leaf
+      virtual bool slave(const MetaInfo& mi) {
+        if (mi.type() == MetaInfo::PORTFOLIO) {
+          a_max = std::max(a_max,mi.asset());
+          if (mi.asset() > 0U) {
+            for (int i=0; i<y.size(); i++)
+              for (int j=i+1; j<y.size(); j++)
+                rel(*this, y[i], IRT_NQ, y[j]);
+            branch(*this, y, INT_VAR_NONE(), INT_VAL_MIN());
+          }
+        }
+        return true;
+      }
+    };
+
+    unsigned int Stalling::a_max = 0U;
+
+    /// %Test for adaptive portfolio-based search respawning assets
+    class Respawn : public Test {
+    public:
+      /// Initialize test
+      Respawn(void)
+        : Test("PBS::Respawn",HTB_BINARY,HTB_BINARY,HTB_BINARY) {}
+      /// Run test
+      virtual bool run(void) {
+        using namespace Gecode;
+        Stalling* m = new Stalling;
+        Gecode::Search::Options so;
+        so.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+        SEBs sebs(2);
+        sebs[0] = bab<Stalling>();
+        sebs[1] = rbs<Stalling,Gecode::BAB>(so);
+        Gecode::Search::Options mo;
+        mo.adaptive = true;
+        mo.slice = 1;
+        Stalling::a_max = 0U;
+        Gecode::PBS<Stalling,Gecode::BAB> pbs(m,sebs,mo);
+        Gecode::BAB<Stalling> e(m);
+        delete m;
+        Stalling* b = NULL;
+        while (Stalling* s = pbs.next()) {
+          delete b; b = s;
+        }
+        Stalling* c = NULL;
+        while (Stalling* s = e.next()) {
+          delete c; c = s;
+        }
+        // The second asset must have been respawned
+        bool ok = (b != NULL) && (c != NULL) &&
+          (b->c.val() == c->c.val()) && (Stalling::a_max >= 2U);
+        delete b; delete c;
+        return ok;
+      }
+    };
+
+    /// %Test for deterministic parallel search
+    template<template<class> class Engine>
+    class Deterministic : public Test {
+    private:
+      /// Split depth
+      unsigned int d;
+      /// Number of threads
+      unsigned int t;
+      /// Whether the last solution found was the best solution
+      bool ok;
+      /// Record solutions (and statistics if \a stat) of search with \a n threads
+      std::string search(unsigned int n, bool det, bool stat) {
+        HasSolutions* m = new HasSolutions(htb1,htb2,htb3,htc);
+        Gecode::Search::Options o;
+        o.threads = n;
+        o.deterministic = det;
+        o.d_split = d;
+        Engine<HasSolutions> e(m,o);
+        delete m;
+        std::stringstream r;
+        HasSolutions* l = NULL;
+        while (HasSolutions* s = e.next()) {
+          r << s->x;
+          if (stat)
+            r << " (" << e.statistics().node << ","
+              << e.statistics().fail << ")";
+          r << std::endl;
+          delete l; l = s;
+        }
+        r << "(" << e.statistics().node << ","
+          << e.statistics().fail << ")" << std::endl;
+        ok = !Engine<HasSolutions>::best || (l == NULL) || l->best();
+        delete l;
+        return r.str();
+      }
+    public:
+      /// Initialize test
+      Deterministic(const std::string& e, HowToConstrain htc,
+                    HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                    unsigned int d0, unsigned int t0)
+        : Test("Deterministic::"+e+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(d0)+"::"+str(t0),
+               htb1,htb2,htb3,htc), d(d0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        // Solutions and statistics must not depend on the number of threads
+        std::string r = search(t,true,true);
+        if (!ok) {
+          olog << ind(2) << "Last solution is not best" << std::endl;
+          return false;
+        }
+        std::string r2 = search(2,true,true);
+        if (r != r2) {
+          olog << ind(2) << "With " << t << " threads:" << std::endl << r
+               << ind(2) << "With 2 threads:" << std::endl << r2;
+          return false;
+        }
+        // Solutions and statistics must not depend on timing
+        for (int i=0; i<2; i++)
+          if (search(t,true,true) != r) {
+            olog << ind(2) << "Different runs with " << t << " threads"
+                 << std::endl;
+            return false;
+          }
+        // Depth-first search must find the same solutions as sequential search
+        if (htc == HTC_NONE) {
+          std::string s = search(1,false,false);
+          std::string rs = search(t,true,false);
+          if (s != rs) {
+            olog << ind(2) << "Sequential:" << std::endl << s
+                 << ind(2) << "Deterministic:" << std::endl << rs;
+            return false;
+          }
+        }
+        return true;
+      }
+    };
+
+#if defined(GECODE_HAS_THREADS) && defined(GECODE_HAS_UNISTD_H)
+
+    /// %Test for distributed search with workers run as threads
+    template<class Model, template<class> class Engine>
+    class Dist : public Test {
+    private:
+      /// Number of workers
+      unsigned int w;
+      /// Port for the test
+      unsigned int port;
+      /// Next port to be used by a test
+      static unsigned int next_port;
+      /// Worker thread
+      class Worker : public Gecode::Support::Runnable {
+      protected:
+        /// Root space
+        Model* m;
+        /// Port of master
+        unsigned int port;
+        /// Event to signal termination
+        Gecode::Support::Event& e;
+      public:
+        /// Initialize
+        Worker(Model* m0, unsigned int p0, Gecode::Support::Event& e0)
+          : m(m0), port(p0), e(e0) {}
+        /// Run worker until the master quits
+        virtual void run(void) {
+          try {
+            Gecode::distworker<Model,Engine>(m,"localhost",port);
+          } catch (Gecode::Exception&) {}
+          e.signal();
+        }
+      };
+    public:
+      /// Initialize test
+      Dist(const std::string& e, HowToConstrain htc,
+           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+           unsigned int w0)
+        : Test("Dist::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(w0),
+               htb1,htb2,htb3,htc), w(w0), port(next_port++) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::Options o;
+        o.port = port;
+        o.subproblems = 4;
+        Gecode::Support::Event* e = new Gecode::Support::Event[w];
+        bool ok;
+        {
+          Gecode::Dist<Model,Engine> d(m,o);
+          // Workers create the same model, the root might have failed
+          for (unsigned int i=0; i<w; i++)
+            Gecode::Support::Thread::run
+              (new Worker(new Model(htb1,htb2,htb3,htc),port,e[i]));
+          if (!Engine<Model>::best) {
+            int n = m->solutions();
+            while (Model* s = d.next()) {
+              n--; delete s;
+            }
+            ok = (n == 0);
+          } else {
+            Model* b = NULL;
+            while (Model* s = d.next()) {
+              delete b; b = s;
+            }
+            ok = (b == NULL) ? (m->solutions() == 0) : b->best();
+            delete b;
+          }
+        }
+        // Workers terminate when the master is gone
+        for (unsigned int i=0; i<w; i++)
+          e[i].wait();
+        delete [] e;
+        delete m;
+        return ok;
+      }
+    };
+
+    template<class Model, template<class> class Engine>
+    unsigned int Dist<Model,Engine>::next_port = 16566U;
+
+#endif
+
+    /// %Test for best solution search with objective bounds
+    template<class Optimize>
+    class Objective : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+      /// Return cost of best solution found with \a n threads
+      int search(unsigned int n, bool ob) {
+        HasObjective<Optimize>* m = new HasObjective<Optimize>;
+        Gecode::Search::Options o;
+        o.threads = n;
+        o.objective = ob;
+        Gecode::BAB<HasObjective<Optimize> > e(m,o);
+        delete m;
+        int c = 0;
+        while (HasObjective<Optimize>* s = e.next()) {
+          c = s->c.val();
+          delete s;
+        }
+        return c;
+      }
+    public:
+      /// Initialize test
+      Objective(const std::string& e, unsigned int t0)
+        : Test("Objective::"+e+"::"+str(t0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        // Compare with the optimum found by sequential search
+        int c = search(1,false);
+        return (search(t,false) == c) && (search(t,true) == c);
+      }
+    };
+
+    /// %Model with objective that adds constraints when constrained
+    template<class Optimize>
+    class HasSideObjective : public HasObjective<Optimize> {
+    public:
+      using HasObjective<Optimize>::x;
+      /// Constructor for space creation
+      HasSideObjective(void) {}
+      /// Constructor for cloning \a s
+      HasSideObjective(HasSideObjective& s) : HasObjective<Optimize>(s) {}
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new HasSideObjective(*this);
+      }
+      /// Constrain by cost and by a different first variable
+      virtual void constrain(const Space& _b) {
+        Optimize::constrain(_b);
+        const HasSideObjective& b = static_cast<const HasSideObjective&>(_b);
+        rel(*this, x[0], IRT_NQ, b.x[0].val());
+      }
+    };
+
+    /// %Test that parallel best solution search uses overridden constrain
+    template<class Optimize>
+    class Constrain : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Constrain(const std::string& e, unsigned int t0)
+        : Test("Constrain::"+e+"::"+str(t0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        HasSideObjective<Optimize>* m = new HasSideObjective<Optimize>;
+        Gecode::Search::Options o;
+        o.threads = t;
+        Gecode::BAB<HasSideObjective<Optimize> > e(m,o);
+        delete m;
+        bool ok = true;
+        HasSideObjective<Optimize>* l = NULL;
+        while (HasSideObjective<Optimize>* s = e.next()) {
+          // Every solution must be better than the previous one
+          long long int ol, os;
+          if ((l != NULL) &&
+              (!l->objective(ol) || !s->objective(os) || (os >= ol) ||
+               (s->x[0].val() == l->x[0].val())))
+            ok = false;
+          delete l; l = s;
+        }
+        delete l;
+        return ok;
+      }
+    };
+
+    /// %Test for restart-based search with a no-good store
+    class NoGoodStore : public Test {
+    private:
+      /// Number of pigeons
+      int p;
+      /// Number of holes
+      int h;
+      /// Search with store \a s, return whether a solution exists
+      bool search(Gecode::Search::NoGoodStore& s,
+                  Gecode::Search::Statistics& stat, bool& stopped) {
+        Pigeons* m = new Pigeons(p,h);
+        Gecode::Search::FailStop f(100000);
+        Gecode::Search::Options o;
+        o.nogoods_limit = 128;
+        o.nogoods_store = &s;
+        o.stop = &f;
+        o.cutoff = Gecode::Search::Cutoff::constant(4);
+        Gecode::RBS<Pigeons,Gecode::DFS> e(m,o);
+        delete m;
+        Pigeons* x = e.next();
+        bool ok = (x != NULL);
+        if (x != NULL)
+          for (int i=0; i<p; i++)
+            for (int j=i+1; j<p; j++)
+              ok = ok && (x->x[i].val() != x->x[j].val());
+        delete x;
+        stat = e.statistics();
+        stopped = e.stopped();
+        return ok;
+      }
+    public:
+      /// Initialize test
+      NoGoodStore(int p0, int h0)
+        : Test("NoGoodStore::"+str(static_cast<unsigned int>(p0))+"::"+
+               str(static_cast<unsigned int>(h0)),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), p(p0), h(h0) {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::NoGoodStore s(64);
+        Gecode::Search::Statistics s1, s2;
+        bool t1, t2;
+        bool f1 = search(s,s1,t1);
+        // Search again with the no-goods from the first search
+        bool f2 = search(s,s2,t2);
+        if (t1 || t2 || (f1 != f2) || (f1 != (p <= h)))
+          return false;
+        // The store must have helped
+        return (s.size() <= 64) && (s2.fail <= s1.fail);
+      }
+    };
+
+    /// %Test that branch-and-bound does not record no-goods in a store
+    class NoGoodStoreBAB : public Test {
+    public:
+      /// Initialize test
+      NoGoodStoreBAB(void)
+        : Test("NoGoodStore::BAB",HTB_BINARY,HTB_BINARY,HTB_BINARY) {}
+      /// Run test
+      virtual bool run(void) {
+        typedef HasObjective<Gecode::IntMinimizeSpace> Model;
+        Gecode::Search::NoGoodStore s(64);
+        Model* m = new Model;
+        Gecode::Search::Options o;
+        o.nogoods_limit = 128;
+        o.nogoods_store = &s;
+        o.cutoff = Gecode::Search::Cutoff::constant(2);
+        Gecode::RBS<Model,Gecode::BAB> r(m,o);
+        Gecode::BAB<Model> b(m);
+        delete m;
+        Model* x = NULL;
+        while (Model* n = r.next()) {
+          delete x; x = n;
+        }
+        Model* y = NULL;
+        while (Model* n = b.next()) {
+          delete y; y = n;
+        }
+        bool ok = (x != NULL) && (y != NULL) &&
+          (x->c.val() == y->c.val()) && (s.size() == 0U) &&
+          (r.statistics().restart > 0UL);
+        delete x; delete y;
+        return ok;
+      }
+    };
+
+    /// %Test for large neighborhood search
+    template<class Optimize, template<class> class Engine>
+    class LNS : public Test {
+    private:
+      /// Whether neighborhoods are selected by a bandit
+      bool b;
+      /// Number of threads
+      unsigned int t;
+      /// Space class used
+      typedef HasObjective<Optimize> Model;
+    public:
+      /// Initialize test
+      LNS(const std::string& e, const std::string& o, bool b0,
+          unsigned int t0)
+        : Test("LNS::"+e+"::"+o+"::"+(b0 ? "Bandit" : "Uniform")+"::"+
+               str(t0),HTB_BINARY,HTB_BINARY,HTB_BINARY), b(b0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        // Find optimal cost
+        int c = 0;
+        {
+          Model* m = new Model;
+          Gecode::BAB<Model> e(m);
+          delete m;
+          while (Model* s = e.next()) {
+            c = s->c.val(); delete s;
+          }
+        }
+        std::vector<Gecode::Search::Neighborhood*> n =
+          {new Gecode::RandomNeighborhood<Model,IntVarArray>(&Model::x),
+           new Gecode::PropagationNeighborhood<Model,IntVarArray>(&Model::x)};
+        Gecode::Search::FailStop f(100000);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.stop = &f;
+        o.neighborhoods = b ?
+          Gecode::Search::Neighborhoods::bandit(n) :
+          Gecode::Search::Neighborhoods::uniform(n);
+        Model* m = new Model;
+        Gecode::LNS<Model,Engine> e(m,o);
+        delete m;
+        bool found = false;
+        int l = 0;
+        while (Model* s = e.next()) {
+          found = true; l = s->c.val(); delete s;
+        }
+        // Search must be complete and the last solution optimal
+        return found && !e.stopped() && (l == c);
+      }
+    };
+
+    /// %Test for search with a memory budget for recomputation
+    template<class Model, template<class> class Engine>
+    class Memory : public Test {
+    private:
+      /// Memory budget
+      size_t b;
+    public:
+      /// Initialize test
+      Memory(const std::string& e, HowToConstrain htc,
+             HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+             size_t b0)
+        : Test("Memory::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(static_cast<unsigned int>(b0)),
+               htb1,htb2,htb3,htc), b(b0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        // Memory for a clone of the root
+        size_t r = 0;
+        if (m->status() != Gecode::SS_FAILED) {
+          Gecode::Space* c = m->clone();
+          r = c->allocated();
+          delete c;
+        }
+        Gecode::Search::Options o;
+        o.memory = b;
+        Engine<Model> e(m,o);
+        int n = m->solutions();
+        delete m;
+        Model* l = NULL;
+        while (Model* s = e.next()) {
+          n--; delete l; l=s;
+        }
+        Gecode::Search::Statistics stat = e.statistics();
+        bool ok = Engine<Model>::best ?
+          ((l == NULL) || l->best()) : (n == 0);
+        delete l;
+        // Clones must have been created if search branched
+        if ((stat.node > 1) && ((stat.clone == 0) || (stat.memory == 0)))
+          return false;
+        /*
+         * The clone of the root is always kept and a clone is admitted
+         * if a clone of estimated size fits into the budget. A clone
+         * constrained by branch-and-bound can exceed the estimate.
+         */
+        return ok && (stat.memory <= b + 2*r);
+      }
+    };
+
+    /// %Test for search with strict batch recomputation
+    template<class Model, template<class> class Engine>
+    class Batch : public Test {
+    private:
+      /// Minimal recomputation distance
+      unsigned int c_d;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Batch(const std::string& e, HowToConstrain htc,
+            HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+            unsigned int c_d0, unsigned int t0)
+        : Test("Batch::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
+               str(c_d0)+"::"+str(t0),
+               htb1,htb2,htb3,htc), c_d(c_d0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::Options o;
+        o.batch = true;
+        o.c_d = c_d;
+        o.a_d = 1;
+        o.threads = t;
+        Engine<Model> e(m,o);
+        int n = m->solutions();
+        delete m;
+        Model* l = NULL;
+        while (Model* s = e.next()) {
+          n--; delete l; l=s;
+        }
+        bool ok = Engine<Model>::best ?
+          ((l == NULL) || l->best()) : (n == 0);
+        delete l;
+        return ok;
+      }
+    };
+
+    /// %Test for instrumented search
+    template<class Model, template<class> class Engine>
+    class Instrument : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Instrument(const std::string& e, HowToConstrain htc,
+                 HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                 unsigned int t0)
+        : Test("Instrument::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3,htc), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::Options o;
+        o.instrument = true;
+        o.threads = t;
+        Engine<Model> e(m,o);
+        delete m;
+        while (Model* s = e.next())
+          delete s;
+        Gecode::Search::Statistics stat = e.statistics();
+        if (!stat.histograms())
+          return false;
+        // All failures must be recorded by depth
+        unsigned long int f = 0;
+        for (unsigned int i=0; i<Gecode::Search::Config::fail_depth; i++)
+          f += stat.fail_depth(i);
+        if (f != stat.fail)
+          return false;
+        // Work can only be stolen with several threads
+        unsigned long int s = 0;
+        for (unsigned int i=0; i<Gecode::Search::Config::steal_worker; i++)
+          s += stat.steal_worker(i);
+        if ((t == 1) && (s > 0))
+          return false;
+        // Sequential search neither steals nor idles
+        if ((t == 1) && ((stat.t_steal != 0.0) || (stat.t_idle != 0.0)))
+          return false;
+        // Without instrumentation, neither histograms nor times are recorded
+        m = new Model(htb1,htb2,htb3,htc);
+        o.instrument = false;
+        Engine<Model> n(m,o);
+        delete m;
+        while (Model* r = n.next())
+          delete r;
+        Gecode::Search::Statistics nstat = n.statistics();
+        return !nstat.histograms() && (nstat.fail_depth(0) == 0) &&
+          (nstat.t_propagate == 0.0) && (nstat.t_clone == 0.0) &&
+          (nstat.t_recompute == 0.0) && (nstat.t_steal == 0.0) &&
+          (nstat.t_idle == 0.0);
+      }
+    };
+
+    /// %Test for NUMA-aware parallel search
+    class Numa : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+      /// Number of NUMA nodes
+      unsigned int n;
+    public:
+      /// Initialize test
+      Numa(unsigned int t0, unsigned int n0)
+        : Test("Numa::"+str(t0)+"::"+str(n0),HTB_NONE,HTB_NONE,HTB_NONE),
+          t(t0), n(n0) {}
+      /// Run test
+      virtual bool run(void) {
+        Pigeons* m = new Pigeons(9,8);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.numa = true;
+        o.numa_nodes = n;
+        Gecode::DFS<Pigeons> e(m,o);
+        delete m;
+        if (Pigeons* s = e.next()) {
+          delete s;
+          return false;
+        }
+        Gecode::Search::Statistics stat = e.statistics();
+        if (stat.steal_remote > stat.steal)
+          return false;
+        // All steals are remote if every worker has its own node
+        if (n == t)
+          return (stat.steal > 0) && (stat.steal_remote == stat.steal);
+        // No steal is remote with a single node
+        if (n == 1)
+          return stat.steal_remote == 0;
+        return true;
+      }
+    };
+
+    /// Return name of a checkpoint file in the temporary directory
+    std::string file(void) {
+      const char* d = std::getenv("TMPDIR");
+      if (d == NULL)
+        d = std::getenv("TEMP");
+      if (d == NULL)
+        d = std::getenv("TMP");
+      return std::string((d != NULL) ? d : "/tmp") +
+        "/gecode-test-search-checkpoint";
+    }
+
+    /// %Test for checkpointing and resuming search
+    template<class Model, template<class> class Engine>
+    class Checkpoint : public Test {
+    public:
+      /// Initialize test
+      Checkpoint(const std::string& e, HowToConstrain htc,
+                 HowToBranch htb1, HowToBranch htb2, HowToBranch htb3)
+        : Test("Checkpoint::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3),
+               htb1,htb2,htb3,htc) {}
+      /// Run test
+      virtual bool run(void) {
+        std::string fn = file();
+        (void) std::remove(fn.c_str());
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        int n = m->solutions();
+        Model* b = NULL;
+        bool stopped = true;
+        // Resume with a new engine after every stop
+        while (stopped) {
+          Gecode::Search::FailStop f(2);
+          Gecode::Search::Checkpoint c(fn,0UL);
+          Gecode::Search::Options o;
+          o.stop = &f;
+          o.checkpoint = &c;
+          Engine<Model> e(m,o);
+          while (Model* s = e.next()) {
+            n--; delete b; b=s;
+          }
+          stopped = e.stopped();
+        }
+        delete m;
+        (void) std::remove(fn.c_str());
+        if (Engine<Model>::best) {
+          bool ok = (b == NULL) || b->best();
+          delete b;
+          return ok;
+        }
+        delete b;
+        return n == 0;
+      }
+    };
+
+    /// %Test that resuming from an incomplete checkpoint fails
+    template<template<class> class Engine>
+    class CheckpointIncomplete : public Test {
+    public:
+      /// Initialize test
+      CheckpointIncomplete(const std::string& e)
+        : Test("Checkpoint::Incomplete::"+e,
+               HTB_BINARY,HTB_BINARY,HTB_BINARY,HTC_LEX_LE) {}
+      /// Run test
+      virtual bool run(void) {
+        std::string fn = file();
+        HasSolutions* m = new HasSolutions(htb1,htb2,htb3,htc);
+        bool ok = true;
+        // Cut off the path after the number of edges and after an edge
+        for (unsigned int n=1U; n<=2U; n++) {
+          Gecode::Search::Checkpoint c(fn,0UL);
+          Gecode::Archive a;
+          a << 0U << 2U;
+          if (n > 1U)
+            a << 0U << 0U;
+          c.write(a);
+          Gecode::Search::Options o;
+          o.checkpoint = &c;
+          try {
+            Engine<HasSolutions> e(m,o);
+            ok = false;
+          } catch (Gecode::Search::CheckpointFailure&) {}
+        }
+        delete m;
+        (void) std::remove(fn.c_str());
+        return ok;
+      }
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -753,6 +1674,25 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Embarrassingly parallel search
+        for (unsigned int t=1; t<=4; t++)
+          for (unsigned int n=1; n<=16; n *= 4) {
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new EPS<HasSolutions>
+                    (HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),n,t);
+                  for (ConstrainTypes htc; htc(); ++htc)
+                    (void) new EPS<HasSolutions>
+                      (htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),n,t);
+                }
+            (void) new EPS<FailImmediate>
+              (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,n,t);
+            (void) new EPS<SolveImmediate>
+              (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,n,t);
+            (void) new EPS<HasSolutions>
+              (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,n,t);
+          }
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
@@ -765,6 +1705,17 @@ namespace Test {
           (void) new RBS<SolveImmediate,Gecode::LDS>("LDS",t);
           (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t);
         }
+        for (unsigned int t=2; t<=4; t++) {
+          (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t,true);
+          (void) new RBS<HasSolutions,Gecode::BAB>("BAB",t,true);
+          (void) new RBS<FailImmediate,Gecode::DFS>("DFS",t,true);
+          (void) new RBS<FailImmediate,Gecode::BAB>("BAB",t,true);
+          (void) new RBS<SolveImmediate,Gecode::DFS>("DFS",t,true);
+          (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t,true);
+        }
+#ifdef GECODE_HAS_THREADS
+        (void) new UncopiableCutoff;
+#endif
         // Portfolio-based search
         for (unsigned int a=1; a<=4; a++)
           for (unsigned int t=1; t<=2*a; t++) {
@@ -778,6 +1729,11 @@ namespace Test {
             (void) new PBS<SolveImmediate,Gecode::LDS>("LDS",false,a,t);
             (void) new PBS<SolveImmediate,Gecode::BAB>("BAB",true,a,t);
           }
+        for (unsigned int a=2; a<=4; a++) {
+          (void) new PBS<HasSolutions,Gecode::DFS>("DFS",false,a,1,true);
+          (void) new PBS<HasSolutions,Gecode::BAB>("BAB",true,a,1,true);
+          (void) new PBS<FailImmediate,Gecode::BAB>("BAB",true,a,1,true);
+        }
         // Portfolio-based search using SEBs
         for (unsigned int mt=1; mt<=3; mt += 2)
           for (unsigned int st=1; st<=8; st++) {
@@ -788,6 +1744,107 @@ namespace Test {
             (void) new SEBPBS<FailImmediate>("DFS+LDS",false,mt,st);
             (void) new SEBPBS<SolveImmediate>("DFS+LDS",false,mt,st);
           }
+        (void) new Respawn;
+        // Deterministic parallel search
+        for (unsigned int t=2; t<=4; t++)
+          for (unsigned int d=1; d<=9; d += 4)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new Deterministic<Gecode::DFS>
+                    ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),d,t);
+                  for (ConstrainTypes htc; htc(); ++htc)
+                    (void) new Deterministic<Gecode::BAB>
+                      ("BAB",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),d,t);
+                }
+        // Restart-based search with a no-good store
+        (void) new NoGoodStore(5,5);
+        (void) new NoGoodStore(6,5);
+        (void) new NoGoodStore(7,6);
+        (void) new NoGoodStoreBAB;
+        // Large neighborhood search
+        for (unsigned int t=1; t<=2; t++)
+          for (int b=0; b<2; b++) {
+            (void) new LNS<IntMinimizeSpace,Gecode::DFS>("DFS","Min",b,t);
+            (void) new LNS<IntMaximizeSpace,Gecode::DFS>("DFS","Max",b,t);
+            (void) new LNS<IntMinimizeSpace,Gecode::BAB>("BAB","Min",b,t);
+          }
+        // Search with a memory budget
+        for (size_t b=1; b<=(1 << 20); b <<= 10)
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2) {
+              (void) new Memory<HasSolutions,Gecode::DFS>
+                ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),HTB_BINARY,b);
+              (void) new Memory<HasSolutions,Gecode::BAB>
+                ("BAB",HTC_LEX_LE,htb1.htb(),htb2.htb(),HTB_NARY,b);
+            }
+        // Search with strict batch recomputation
+        for (unsigned int t=1; t<=2; t++)
+          for (unsigned int c_d=1; c_d<=8; c_d <<= 1)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2) {
+                (void) new Batch<HasSolutions,Gecode::DFS>
+                  ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),HTB_BINARY,c_d,t);
+                for (ConstrainTypes htc; htc(); ++htc)
+                  (void) new Batch<HasSolutions,Gecode::BAB>
+                    ("BAB",htc.htc(),htb1.htb(),htb2.htb(),HTB_NARY,c_d,t);
+              }
+        // Instrumented search
+        for (unsigned int t=1; t<=2; t++)
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2) {
+              (void) new Instrument<HasSolutions,Gecode::DFS>
+                ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),HTB_BINARY,t);
+              (void) new Instrument<HasSolutions,Gecode::BAB>
+                ("BAB",HTC_LEX_LE,htb1.htb(),htb2.htb(),HTB_NARY,t);
+            }
+#ifdef GECODE_HAS_THREADS
+        // NUMA-aware parallel search
+        for (unsigned int t=2; t<=4; t += 2)
+          for (unsigned int n=1; n<=t; n++)
+            (void) new Numa(t,n);
+#endif
+        // Checkpointing and resuming search
+        for (BranchTypes htb1; htb1(); ++htb1)
+          for (BranchTypes htb2; htb2(); ++htb2)
+            for (BranchTypes htb3; htb3(); ++htb3) {
+              (void) new Checkpoint<HasSolutions,Gecode::DFS>
+                ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb());
+              for (ConstrainTypes htc; htc(); ++htc)
+                (void) new Checkpoint<HasSolutions,Gecode::BAB>
+                  ("BAB",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb());
+            }
+        (void) new Checkpoint<FailImmediate,Gecode::DFS>
+          ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE);
+        (void) new Checkpoint<SolveImmediate,Gecode::DFS>
+          ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE);
+        (void) new Checkpoint<SolveImmediate,Gecode::BAB>
+          ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE);
+        (void) new CheckpointIncomplete<Gecode::DFS>("DFS");
+        (void) new CheckpointIncomplete<Gecode::BAB>("BAB");
+        // Best solution search with objective bounds
+        for (unsigned int t=2; t<=4; t++) {
+          (void) new Objective<IntMinimizeSpace>("Min",t);
+          (void) new Objective<IntMaximizeSpace>("Max",t);
+          (void) new Constrain<IntMinimizeSpace>("Min",t);
+          (void) new Constrain<IntMaximizeSpace>("Max",t);
+        }
+#if defined(GECODE_HAS_THREADS) && defined(GECODE_HAS_UNISTD_H)
+        // Distributed search
+        for (unsigned int w=1; w<=2; w++) {
+          (void) new Dist<HasSolutions,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_BINARY,HTB_BINARY,HTB_BINARY,w);
+          (void) new Dist<HasSolutions,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NARY,HTB_UNARY,HTB_BINARY,w);
+          for (ConstrainTypes htc; htc(); ++htc)
+            (void) new Dist<HasSolutions,Gecode::BAB>
+              ("BAB",htc.htc(),HTB_BINARY,HTB_NARY,HTB_UNARY,w);
+          (void) new Dist<FailImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,w);
+          (void) new Dist<SolveImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,w);
+        }
+#endif
       }
     };
 